@@ -1204,6 +1204,132 @@ public static class GenExtensions
         return 0;
     }
 
+    /// <summary>
+    /// 判断成员是否标记了 Packed. 成员类型不是 List<数值> 将抛异常
+    /// </summary>
+    public static bool _IsPacked(this FieldInfo f)
+    {
+        if (!f._Has<TemplateLibrary.Packed>()) return false;
+        var ft = f.FieldType;
+        if (!ft._IsList() || !ft.GenericTypeArguments[0]._IsNumeric())
+        {
+            throw new Exception("Packed 只能用于 List<数值> 类型的成员: " + f.DeclaringType.FullName + "." + f.Name);
+        }
+        return true;
+    }
+
+
+    /// <summary>
+    /// 判断类型是否按树序列化: 标记了 Tree 的类, 或 元素为这种类( 可嵌套 List ) 的 List. 标记了 Tree 但不满足条件将抛异常
+    /// </summary>
+    public static bool _IsTree(this Type t, Assembly asm)
+    {
+        if (t._IsList()) return t.GenericTypeArguments[0]._IsTree(asm);
+        if (!t._IsUserClass() || !t._Has<TemplateLibrary.Tree>()) return false;
+
+        // 任何 Ref 都不能指向它( 写入时会被当成新对象再写一份, 读出后无人持有 )
+        foreach (var c in asm._GetTypes()._GetClasssStructs())
+        {
+            foreach (var f in c._GetFields())
+            {
+                if (f.FieldType._IsRef() && f.FieldType.GenericTypeArguments[0].IsAssignableFrom(t))
+                {
+                    throw new Exception("Tree 类不可被 Ref 指向: " + t.FullName + ", " + c.FullName + "." + f.Name);
+                }
+            }
+        }
+
+        // 沿成员类型( 含 派生类 ) 遍历, 不可回到自身
+        var visited = new HashSet<Type>();
+        var stack = new Stack<Type>();
+        stack.Push(t);
+        while (stack.Count > 0)
+        {
+            foreach (var f in stack.Pop()._GetFields())
+            {
+                var ft = f.FieldType;
+                while (ft._IsList() || ft._IsNullable()) ft = ft.GenericTypeArguments[0];
+                if (ft._IsRef() || ft._IsObject())
+                {
+                    throw new Exception("Tree 类的可达成员不可为 Ref / object: " + t.FullName + ", " + f.DeclaringType.FullName + "." + f.Name);
+                }
+                if (ft.IsEnum || ft.IsPrimitive || ft._IsString() || ft._IsBBuffer() || ft._IsExternal()) continue;
+                var nts = ft.IsClass ? ft._GetDerivedTypes(asm) : new List<Type> { ft };
+                foreach (var nt in nts)
+                {
+                    if (nt == t)
+                    {
+                        throw new Exception("Tree 类的可达成员不可指回自身: " + t.FullName + ", " + f.DeclaringType.FullName + "." + f.Name);
+                    }
+                    if (visited.Add(nt)) stack.Push(nt);
+                }
+            }
+        }
+        return true;
+    }
+
+
+    /// <summary>
+    /// 判断类是否标记了 Delta. 父类未标记 或 成员类型不支持 将抛异常
+    /// </summary>
+    public static bool _IsDelta(this Type t)
+    {
+        if (!t._Has<TemplateLibrary.Delta>()) return false;
+        if (t._HasBaseType() && !t.BaseType._IsDelta())
+        {
+            throw new Exception("Delta 类的父类也需标记 Delta: " + t.FullName);
+        }
+        foreach (var f in t._GetFields())
+        {
+            var ft = f.FieldType;
+            if (ft._IsList()) ft = ft.GenericTypeArguments[0];
+            if (ft._IsNullable()) ft = ft.GenericTypeArguments[0];
+            if (f._IsView() || !(ft._IsNumeric() || ft.IsEnum || ft._IsString() || ft._IsExternal()))
+            {
+                throw new Exception("Delta 类成员只能是 数值, 枚举, string, 外部结构 及其可空 / List: " + t.FullName + "." + f.Name);
+            }
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// 获取 Quantize 值. 未标记返回 0. 成员类型不是 float / double / 外部结构 及其可空 / List 将抛异常
+    /// </summary>
+    public static double _GetQuantize(this FieldInfo f)
+    {
+        foreach (var a in f.GetCustomAttributes(false))
+        {
+            if (a is TemplateLibrary.Quantize)
+            {
+                var ft = f.FieldType;
+                if (ft._IsList()) ft = ft.GenericTypeArguments[0];
+                if (ft._IsNullable()) ft = ft.GenericTypeArguments[0];
+                var v = ((TemplateLibrary.Quantize)a).value;
+                if (!(ft == typeof(float) || ft == typeof(double) || ft._IsExternal()) || !(v > 0))
+                {
+                    throw new Exception("Quantize 只能以正数用于 float / double / 外部结构 及其可空 / List 成员: " + f.DeclaringType.FullName + "." + f.Name);
+                }
+                return v;
+            }
+        }
+        return 0;
+    }
+
+
+    /// <summary>
+    /// 判断成员是否标记了 View. 成员类型不是 string / BBuffer 将抛异常
+    /// </summary>
+    public static bool _IsView(this FieldInfo f)
+    {
+        if (!f._Has<TemplateLibrary.View>()) return false;
+        var ft = f.FieldType;
+        if (!ft._IsString() && !ft._IsBBuffer())
+        {
+            throw new Exception("View 只能用于 string / BBuffer 类型的成员: " + f.DeclaringType.FullName + "." + f.Name);
+        }
+        return true;
+    }
+
 
     /// <summary>
     /// 获取 Attribute 之 Desc 注释. 未找到将返回 ""
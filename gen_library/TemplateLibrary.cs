@@ -247,6 +247,53 @@ namespace TemplateLibrary
         public int value;
     }
 
+    /// <summary>
+    /// 标记 List<数值> 类型成员以打包方式序列化: 长度 + 元素原始小尾字节( 不做变长压缩, 数组大时快很多 ). 暂不支持 lua
+    /// </summary>
+    [System.AttributeUsage(System.AttributeTargets.Field)]
+    public class Packed : System.Attribute
+    {
+    }
+
+    /// <summary>
+    /// 标记 string / BBuffer 类型成员在 c++ 中生成为 xx::StrView / xx::BufView( 解包时直接指向收到的数据, 不分配不复制. 只在收包回调内有效 ). 别的语言不受影响
+    /// </summary>
+    [System.AttributeUsage(System.AttributeTargets.Field)]
+    public class View : System.Attribute
+    {
+    }
+
+    /// <summary>
+    /// 标记类的对象图为树( 无共享, 无循环引用 ). 生成器会检查 其成员可达的类型中 不会再回到该类, 且无 Ref / object 成员, 且任何 Ref 都不会指向它.
+    /// 此类及 元素为此类 的 List 在 c++ / c# 中序列化时不经 ptrStore / idxStore 字典, 也不写 offset( 与未标记时的数据格式不兼容 ). 同一对象被多处指向时将被写多份. 暂不支持 lua
+    /// </summary>
+    [System.AttributeUsage(System.AttributeTargets.Class)]
+    public class Tree : System.Attribute
+    {
+    }
+
+    /// <summary>
+    /// 标记类在 c++ 中生成差量快照函数 WriteDelta / ReadDelta( 以对端已确认的基准对象为参照, 只写有变化的成员 ). 父类也需标记.
+    /// 成员只能是 数值, 枚举, string, 外部结构( 如 xx::Pos, 需提供 xx::DeltaFunc 适配 ), 它们的可空 及 List
+    /// </summary>
+    [System.AttributeUsage(System.AttributeTargets.Class)]
+    public class Delta : System.Attribute
+    {
+    }
+
+    /// <summary>
+    /// 标记 Delta 类中 float / double / 外部结构( 如 xx::Pos ) 及其 List 成员的差量量化精度. 例如 0.01 即以 1/100 为单位转定点整数写差值
+    /// </summary>
+    [System.AttributeUsage(System.AttributeTargets.Field)]
+    public class Quantize : System.Attribute
+    {
+        public Quantize(double value)
+        {
+            this.value = value;
+        }
+        public double value;
+    }
+
 
 
 
@@ -58,10 +58,24 @@ namespace LOGDB
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Log* const& o) const noexcept;
         Log* MakeCopy() const noexcept;
         Log_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int64_t& out) noexcept;
+        static int Read_level(xx::BBuffer& bb, LOGDB::Level& out) noexcept;
+        static int Read_time(xx::BBuffer& bb, int64_t& out) noexcept;
+        static int Read_machine(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_service(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_instanceId(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_title(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_opcode(xx::BBuffer& bb, int64_t& out) noexcept;
+        static int Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 namespace xx
@@ -91,6 +105,18 @@ namespace LOGDB
         bb.Write(this->opcode);
         bb.Write(this->desc);
     }
+    inline void Log::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->level);
+        bb.CalcLen(len, this->time);
+        bb.CalcLen(len, this->machine);
+        bb.CalcLen(len, this->service);
+        bb.CalcLen(len, this->instanceId);
+        bb.CalcLen(len, this->title);
+        bb.CalcLen(len, this->opcode);
+        bb.CalcLen(len, this->desc);
+    }
     inline int Log::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -113,6 +139,122 @@ namespace LOGDB
         if (int r = bb.Read(this->desc)) return r;
         return 0;
     }
+    inline int Log::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 9);
+    }
+    inline int Log::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int64_t>()) return r;
+        if (n == 1) return 0;
+        if (int r = bb.Skip<LOGDB::Level>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<int64_t>()) return r;
+        if (n == 3) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 4) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 5) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 6) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<int64_t>()) return r;
+        if (n == 8) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Log::Read_id(xx::BBuffer& bb, int64_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Log::Read_level(xx::BBuffer& bb, LOGDB::Level& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        return bb.Read(out);
+    }
+    inline int Log::Read_time(xx::BBuffer& bb, int64_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int Log::Read_machine(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Log::Read_service(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Log::Read_instanceId(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Log::Read_title(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Log::Read_opcode(xx::BBuffer& bb, int64_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int Log::Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Log::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Log\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Log::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int64_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"level\":");
+        if (int r = xx::JsonFunc<LOGDB::Level>::WriteTo(bb, s)) return r;
+        s.Append(",\"time\":");
+        if (int r = xx::JsonFunc<int64_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"machine\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"service\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"instanceId\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"title\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"opcode\":");
+        if (int r = xx::JsonFunc<int64_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"desc\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Log::ToString(xx::String& s) const noexcept
     {
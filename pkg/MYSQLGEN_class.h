@@ -69,10 +69,36 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(TABLES* const& o) const noexcept;
         TABLES* MakeCopy() const noexcept;
         TABLES_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_TABLE_CATALOG(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_SCHEMA(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_ENGINE(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_VERSION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_ROW_FORMAT(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_ROWS(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_AVG_ROW_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_DATA_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_MAX_DATA_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_INDEX_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_DATA_FREE(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_AUTO_INCREMENT(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_CREATE_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_UPDATE_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_CHECK_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_COLLATION(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_CHECKSUM(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_CREATE_OPTIONS(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_COMMENT(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     class COLUMNS : public xx::Object
     {
@@ -110,10 +136,36 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(COLUMNS* const& o) const noexcept;
         COLUMNS* MakeCopy() const noexcept;
         COLUMNS_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_TABLE_CATALOG(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_SCHEMA(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_TABLE_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_COLUMN_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_ORDINAL_POSITION(xx::BBuffer& bb, int64_t& out) noexcept;
+        static int Read_COLUMN_DEFAULT(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_IS_NULLABLE(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_DATA_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_CHARACTER_MAXIMUM_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_CHARACTER_OCTET_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_NUMERIC_PRECISION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_NUMERIC_SCALE(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_DATETIME_PRECISION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept;
+        static int Read_CHARACTER_SET_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_COLLATION_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_COLUMN_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_COLUMN_KEY(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_EXTRA(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_PRIVILEGES(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_COLUMN_COMMENT(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_GENERATION_EXPRESSION(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
     class DbTable : public MYSQLGEN::Tables::TABLES
@@ -133,10 +185,17 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(DbTable* const& o) const noexcept;
         DbTable* MakeCopy() const noexcept;
         DbTable_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_childs(xx::BBuffer& bb, xx::List_p<MYSQLGEN::DbColumn_p>& out) noexcept;
+        static int Read_createScript(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     class DbColumn : public MYSQLGEN::Tables::COLUMNS
     {
@@ -154,10 +213,16 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(DbColumn* const& o) const noexcept;
         DbColumn* MakeCopy() const noexcept;
         DbColumn_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_parent(xx::BBuffer& bb, MYSQLGEN::DbTable_p& out) noexcept;
     };
 namespace Tables
 {
@@ -178,10 +243,17 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(show_create_table* const& o) const noexcept;
         show_create_table* MakeCopy() const noexcept;
         show_create_table_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_Table(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_CreateTable(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 }
@@ -211,6 +283,12 @@ namespace MYSQLGEN
         bb.Write(this->childs);
         bb.Write(this->createScript);
     }
+    inline void DbTable::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+        bb.CalcLen(len, this->childs);
+        bb.CalcLen(len, this->createScript);
+    }
     inline int DbTable::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -224,6 +302,51 @@ namespace MYSQLGEN
         if (int r = bb.Read(this->createScript)) return r;
         return 0;
     }
+    inline int DbTable::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int DbTable::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<MYSQLGEN::DbColumn_p>>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int DbTable::Read_childs(xx::BBuffer& bb, xx::List_p<MYSQLGEN::DbColumn_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int DbTable::Read_createScript(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int DbTable::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"DbTable\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int DbTable::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"childs\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<MYSQLGEN::DbColumn_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"createScript\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void DbTable::ToString(xx::String& s) const noexcept
     {
@@ -278,6 +401,11 @@ namespace MYSQLGEN
         this->BaseType::ToBBuffer(bb);
         bb.Write(this->parent);
     }
+    inline void DbColumn::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+        bb.CalcLen(len, this->parent);
+    }
     inline int DbColumn::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -288,6 +416,36 @@ namespace MYSQLGEN
         if (int r = bb.Read(this->parent)) return r;
         return 0;
     }
+    inline int DbColumn::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int DbColumn::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        if (n == 0) return 0;
+        if (int r = bb.Skip<MYSQLGEN::DbTable_p>()) return r;
+        return 0;
+    }
+    inline int DbColumn::Read_parent(xx::BBuffer& bb, MYSQLGEN::DbTable_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int DbColumn::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"DbColumn\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int DbColumn::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"parent\":");
+        if (int r = xx::JsonFunc<MYSQLGEN::DbTable_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void DbColumn::ToString(xx::String& s) const noexcept
     {
@@ -360,6 +518,30 @@ namespace Tables
         bb.Write(this->CREATE_OPTIONS);
         bb.Write(this->TABLE_COMMENT);
     }
+    inline void TABLES::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->TABLE_CATALOG);
+        bb.CalcLen(len, this->TABLE_SCHEMA);
+        bb.CalcLen(len, this->TABLE_NAME);
+        bb.CalcLen(len, this->TABLE_TYPE);
+        bb.CalcLen(len, this->ENGINE);
+        bb.CalcLen(len, this->VERSION);
+        bb.CalcLen(len, this->ROW_FORMAT);
+        bb.CalcLen(len, this->TABLE_ROWS);
+        bb.CalcLen(len, this->AVG_ROW_LENGTH);
+        bb.CalcLen(len, this->DATA_LENGTH);
+        bb.CalcLen(len, this->MAX_DATA_LENGTH);
+        bb.CalcLen(len, this->INDEX_LENGTH);
+        bb.CalcLen(len, this->DATA_FREE);
+        bb.CalcLen(len, this->AUTO_INCREMENT);
+        bb.CalcLen(len, this->CREATE_TIME);
+        bb.CalcLen(len, this->UPDATE_TIME);
+        bb.CalcLen(len, this->CHECK_TIME);
+        bb.CalcLen(len, this->TABLE_COLLATION);
+        bb.CalcLen(len, this->CHECKSUM);
+        bb.CalcLen(len, this->CREATE_OPTIONS);
+        bb.CalcLen(len, this->TABLE_COMMENT);
+    }
     inline int TABLES::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -401,6 +583,251 @@ namespace Tables
         if (int r = bb.Read(this->TABLE_COMMENT)) return r;
         return 0;
     }
+    inline int TABLES::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 21);
+    }
+    inline int TABLES::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 3) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 4) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 6) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 8) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 9) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 10) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 11) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 12) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 13) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 14) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 15) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 16) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 17) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 18) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 19) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 20) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int TABLES::Read_TABLE_CATALOG(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_SCHEMA(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_ENGINE(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_VERSION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_ROW_FORMAT(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_ROWS(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_AVG_ROW_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_DATA_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_MAX_DATA_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 10)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_INDEX_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 11)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_DATA_FREE(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 12)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_AUTO_INCREMENT(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 13)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_CREATE_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 14)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_UPDATE_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 15)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_CHECK_TIME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 16)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_COLLATION(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 17)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_CHECKSUM(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 18)) return r;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_CREATE_OPTIONS(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 19)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::Read_TABLE_COMMENT(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 20)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TABLES::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.TABLES\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int TABLES::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"TABLE_CATALOG\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_SCHEMA\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_NAME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_TYPE\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"ENGINE\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"VERSION\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"ROW_FORMAT\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_ROWS\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"AVG_ROW_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"DATA_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"MAX_DATA_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"INDEX_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"DATA_FREE\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"AUTO_INCREMENT\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"CREATE_TIME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"UPDATE_TIME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"CHECK_TIME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_COLLATION\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"CHECKSUM\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"CREATE_OPTIONS\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_COMMENT\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void TABLES::ToString(xx::String& s) const noexcept
     {
@@ -522,6 +949,30 @@ namespace Tables
         bb.Write(this->COLUMN_COMMENT);
         bb.Write(this->GENERATION_EXPRESSION);
     }
+    inline void COLUMNS::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->TABLE_CATALOG);
+        bb.CalcLen(len, this->TABLE_SCHEMA);
+        bb.CalcLen(len, this->TABLE_NAME);
+        bb.CalcLen(len, this->COLUMN_NAME);
+        bb.CalcLen(len, this->ORDINAL_POSITION);
+        bb.CalcLen(len, this->COLUMN_DEFAULT);
+        bb.CalcLen(len, this->IS_NULLABLE);
+        bb.CalcLen(len, this->DATA_TYPE);
+        bb.CalcLen(len, this->CHARACTER_MAXIMUM_LENGTH);
+        bb.CalcLen(len, this->CHARACTER_OCTET_LENGTH);
+        bb.CalcLen(len, this->NUMERIC_PRECISION);
+        bb.CalcLen(len, this->NUMERIC_SCALE);
+        bb.CalcLen(len, this->DATETIME_PRECISION);
+        bb.CalcLen(len, this->CHARACTER_SET_NAME);
+        bb.CalcLen(len, this->COLLATION_NAME);
+        bb.CalcLen(len, this->COLUMN_TYPE);
+        bb.CalcLen(len, this->COLUMN_KEY);
+        bb.CalcLen(len, this->EXTRA);
+        bb.CalcLen(len, this->PRIVILEGES);
+        bb.CalcLen(len, this->COLUMN_COMMENT);
+        bb.CalcLen(len, this->GENERATION_EXPRESSION);
+    }
     inline int COLUMNS::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -566,6 +1017,260 @@ namespace Tables
         if (int r = bb.Read(this->GENERATION_EXPRESSION)) return r;
         return 0;
     }
+    inline int COLUMNS::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 21);
+    }
+    inline int COLUMNS::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 3) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<int64_t>()) return r;
+        if (n == 5) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 6) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 7) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 8) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 9) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 10) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 11) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 12) return 0;
+        if (int r = bb.Skip<std::optional<int64_t>>()) return r;
+        if (n == 13) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 14) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 15) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 16) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 17) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 18) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 19) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 20) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int COLUMNS::Read_TABLE_CATALOG(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_TABLE_SCHEMA(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_TABLE_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLUMN_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_ORDINAL_POSITION(xx::BBuffer& bb, int64_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLUMN_DEFAULT(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_IS_NULLABLE(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_DATA_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_CHARACTER_MAXIMUM_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_CHARACTER_OCTET_LENGTH(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_NUMERIC_PRECISION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 10)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_NUMERIC_SCALE(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 11)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_DATETIME_PRECISION(xx::BBuffer& bb, std::optional<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 12)) return r;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_CHARACTER_SET_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 13)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLLATION_NAME(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 14)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLUMN_TYPE(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 15)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLUMN_KEY(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 16)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_EXTRA(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 17)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_PRIVILEGES(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 18)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_COLUMN_COMMENT(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 19)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::Read_GENERATION_EXPRESSION(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 20)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int COLUMNS::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.COLUMNS\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int COLUMNS::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"TABLE_CATALOG\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_SCHEMA\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"TABLE_NAME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLUMN_NAME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"ORDINAL_POSITION\":");
+        if (int r = xx::JsonFunc<int64_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLUMN_DEFAULT\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"IS_NULLABLE\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"DATA_TYPE\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"CHARACTER_MAXIMUM_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"CHARACTER_OCTET_LENGTH\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"NUMERIC_PRECISION\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"NUMERIC_SCALE\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"DATETIME_PRECISION\":");
+        if (int r = xx::JsonFunc<std::optional<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"CHARACTER_SET_NAME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLLATION_NAME\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLUMN_TYPE\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLUMN_KEY\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"EXTRA\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"PRIVILEGES\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"COLUMN_COMMENT\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"GENERATION_EXPRESSION\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void COLUMNS::ToString(xx::String& s) const noexcept
     {
@@ -671,6 +1376,11 @@ namespace Tables
         bb.Write(this->Table);
         bb.Write(this->CreateTable);
     }
+    inline void show_create_table::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->Table);
+        bb.CalcLen(len, this->CreateTable);
+    }
     inline int show_create_table::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -683,6 +1393,50 @@ namespace Tables
         if (int r = bb.Read(this->CreateTable)) return r;
         return 0;
     }
+    inline int show_create_table::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int show_create_table::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int show_create_table::Read_Table(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int show_create_table::Read_CreateTable(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int show_create_table::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.show_create_table\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int show_create_table::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"Table\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"CreateTable\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void show_create_table::ToString(xx::String& s) const noexcept
     {
@@ -34,10 +34,18 @@ namespace PKG
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Player* const& o) const noexcept;
         Player* MakeCopy() const noexcept;
         Player_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_owner(xx::BBuffer& bb, PKG::Scene_p& out) noexcept;
     };
     class Scene : public xx::Object
     {
@@ -55,10 +63,16 @@ namespace PKG
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Scene* const& o) const noexcept;
         Scene* MakeCopy() const noexcept;
         Scene_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_players(xx::BBuffer& bb, xx::List_p<xx::Ref<PKG::Player>>& out) noexcept;
     };
 }
 namespace xx
@@ -84,6 +98,12 @@ namespace PKG
         bb.Write(this->name);
         bb.Write(this->owner);
     }
+    inline void Player::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->owner);
+    }
     inline int Player::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -96,6 +116,56 @@ namespace PKG
         if (int r = bb.Read(this->owner)) return r;
         return 0;
     }
+    inline int Player::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 3);
+    }
+    inline int Player::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<PKG::Scene_p>()) return r;
+        return 0;
+    }
+    inline int Player::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Player::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Player::Read_owner(xx::BBuffer& bb, PKG::Scene_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int Player::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Player\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Player::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"owner\":");
+        if (int r = xx::JsonFunc<PKG::Scene_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Player::ToString(xx::String& s) const noexcept
     {
@@ -150,6 +220,10 @@ namespace PKG
     {
         bb.Write(this->players);
     }
+    inline void Scene::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->players);
+    }
     inline int Scene::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -160,6 +234,38 @@ namespace PKG
         if (int r = bb.Read(this->players)) return r;
         return 0;
     }
+    inline int Scene::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int Scene::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<xx::Ref<PKG::Player>>>()) return r;
+        return 0;
+    }
+    inline int Scene::Read_players(xx::BBuffer& bb, xx::List_p<xx::Ref<PKG::Player>>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Scene::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Scene\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Scene::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"players\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<xx::Ref<PKG::Player>>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Scene::ToString(xx::String& s) const noexcept
     {
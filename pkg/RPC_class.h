@@ -104,10 +104,16 @@ namespace DB_Manage
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(MsgResult* const& o) const noexcept;
         MsgResult* MakeCopy() const noexcept;
         MsgResult_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_txt(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 namespace Manage_DB
@@ -128,10 +134,16 @@ namespace Manage_DB
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Msg* const& o) const noexcept;
         Msg* MakeCopy() const noexcept;
         Msg_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_txt(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 namespace Login_Client
@@ -152,10 +164,16 @@ namespace Login_Client
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(LoginSuccess* const& o) const noexcept;
         LoginSuccess* MakeCopy() const noexcept;
         LoginSuccess_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
     };
 }
 namespace Client_Login
@@ -177,10 +195,17 @@ namespace Client_Login
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Login* const& o) const noexcept;
         Login* MakeCopy() const noexcept;
         Login_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 namespace DB_Login
@@ -201,10 +226,16 @@ namespace DB_Login
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(AuthSuccess* const& o) const noexcept;
         AuthSuccess* MakeCopy() const noexcept;
         AuthSuccess_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
     };
 }
 namespace Login_DB
@@ -226,10 +257,17 @@ namespace Login_DB
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Auth* const& o) const noexcept;
         Auth* MakeCopy() const noexcept;
         Auth_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
 }
 namespace Generic
@@ -252,10 +290,16 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(ServiceInfo* const& o) const noexcept;
         ServiceInfo* MakeCopy() const noexcept;
         ServiceInfo_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_type(xx::BBuffer& bb, RPC::Generic::ServiceTypes& out) noexcept;
     };
     // 通用错误返回
     class Error : public xx::Object
@@ -277,10 +321,17 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Error* const& o) const noexcept;
         Error* MakeCopy() const noexcept;
         Error_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_errNo(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_errMsg(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     // 心跳保持兼延迟测试 -- 请求
     class Ping : public xx::Object
@@ -299,10 +350,16 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Ping* const& o) const noexcept;
         Ping* MakeCopy() const noexcept;
         Ping_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_ticks(xx::BBuffer& bb, double& out) noexcept;
     };
     // 心跳保持兼延迟测试 -- 回应
     class Pong : public xx::Object
@@ -321,10 +378,16 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Pong* const& o) const noexcept;
         Pong* MakeCopy() const noexcept;
         Pong_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_ticks(xx::BBuffer& bb, double& out) noexcept;
     };
 }
 }
@@ -358,6 +421,10 @@ namespace DB_Manage
     {
         bb.Write(this->txt);
     }
+    inline void MsgResult::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->txt);
+    }
     inline int MsgResult::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -368,6 +435,38 @@ namespace DB_Manage
         if (int r = bb.Read(this->txt)) return r;
         return 0;
     }
+    inline int MsgResult::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int MsgResult::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int MsgResult::Read_txt(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int MsgResult::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"DB_Manage.MsgResult\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int MsgResult::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"txt\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void MsgResult::ToString(xx::String& s) const noexcept
     {
@@ -421,6 +520,10 @@ namespace Manage_DB
     {
         bb.Write(this->txt);
     }
+    inline void Msg::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->txt);
+    }
     inline int Msg::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -431,6 +534,38 @@ namespace Manage_DB
         if (int r = bb.Read(this->txt)) return r;
         return 0;
     }
+    inline int Msg::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int Msg::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 200;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Msg::Read_txt(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 200;
+        return bb.Read(out);
+    }
+    inline int Msg::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Manage_DB.Msg\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Msg::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"txt\":");
+        bb.readLengthLimit = 200;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Msg::ToString(xx::String& s) const noexcept
     {
@@ -484,6 +619,10 @@ namespace Login_Client
     {
         bb.Write(this->id);
     }
+    inline void LoginSuccess::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+    }
     inline int LoginSuccess::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -493,6 +632,35 @@ namespace Login_Client
         if (int r = bb.Read(this->id)) return r;
         return 0;
     }
+    inline int LoginSuccess::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int LoginSuccess::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int LoginSuccess::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int LoginSuccess::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Login_Client.LoginSuccess\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int LoginSuccess::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void LoginSuccess::ToString(xx::String& s) const noexcept
     {
@@ -546,6 +714,11 @@ namespace Client_Login
         bb.Write(this->username);
         bb.Write(this->password);
     }
+    inline void Login::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->username);
+        bb.CalcLen(len, this->password);
+    }
     inline int Login::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -558,6 +731,50 @@ namespace Client_Login
         if (int r = bb.Read(this->password)) return r;
         return 0;
     }
+    inline int Login::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Login::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 50;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 50;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Login::Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 50;
+        return bb.Read(out);
+    }
+    inline int Login::Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 50;
+        return bb.Read(out);
+    }
+    inline int Login::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Client_Login.Login\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Login::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"username\":");
+        bb.readLengthLimit = 50;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"password\":");
+        bb.readLengthLimit = 50;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Login::ToString(xx::String& s) const noexcept
     {
@@ -614,6 +831,10 @@ namespace DB_Login
     {
         bb.Write(this->id);
     }
+    inline void AuthSuccess::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+    }
     inline int AuthSuccess::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -623,6 +844,35 @@ namespace DB_Login
         if (int r = bb.Read(this->id)) return r;
         return 0;
     }
+    inline int AuthSuccess::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int AuthSuccess::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int AuthSuccess::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int AuthSuccess::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"DB_Login.AuthSuccess\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int AuthSuccess::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void AuthSuccess::ToString(xx::String& s) const noexcept
     {
@@ -676,6 +926,11 @@ namespace Login_DB
         bb.Write(this->username);
         bb.Write(this->password);
     }
+    inline void Auth::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->username);
+        bb.CalcLen(len, this->password);
+    }
     inline int Auth::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -688,6 +943,50 @@ namespace Login_DB
         if (int r = bb.Read(this->password)) return r;
         return 0;
     }
+    inline int Auth::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Auth::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Auth::Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Auth::Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Auth::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Login_DB.Auth\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Auth::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"username\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"password\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Auth::ToString(xx::String& s) const noexcept
     {
@@ -744,6 +1043,10 @@ namespace Generic
     {
         bb.Write(this->type);
     }
+    inline void ServiceInfo::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->type);
+    }
     inline int ServiceInfo::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -753,6 +1056,35 @@ namespace Generic
         if (int r = bb.Read(this->type)) return r;
         return 0;
     }
+    inline int ServiceInfo::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int ServiceInfo::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<RPC::Generic::ServiceTypes>()) return r;
+        return 0;
+    }
+    inline int ServiceInfo::Read_type(xx::BBuffer& bb, RPC::Generic::ServiceTypes& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int ServiceInfo::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.ServiceInfo\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int ServiceInfo::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"type\":");
+        if (int r = xx::JsonFunc<RPC::Generic::ServiceTypes>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void ServiceInfo::ToString(xx::String& s) const noexcept
     {
@@ -803,6 +1135,11 @@ namespace Generic
         bb.Write(this->errNo);
         bb.Write(this->errMsg);
     }
+    inline void Error::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->errNo);
+        bb.CalcLen(len, this->errMsg);
+    }
     inline int Error::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -814,6 +1151,47 @@ namespace Generic
         if (int r = bb.Read(this->errMsg)) return r;
         return 0;
     }
+    inline int Error::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Error::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Error::Read_errNo(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Error::Read_errMsg(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Error::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.Error\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Error::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"errNo\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"errMsg\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Error::ToString(xx::String& s) const noexcept
     {
@@ -866,6 +1244,10 @@ namespace Generic
     {
         bb.Write(this->ticks);
     }
+    inline void Ping::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->ticks);
+    }
     inline int Ping::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -875,6 +1257,35 @@ namespace Generic
         if (int r = bb.Read(this->ticks)) return r;
         return 0;
     }
+    inline int Ping::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int Ping::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        return 0;
+    }
+    inline int Ping::Read_ticks(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Ping::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.Ping\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Ping::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"ticks\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Ping::ToString(xx::String& s) const noexcept
     {
@@ -924,6 +1335,10 @@ namespace Generic
     {
         bb.Write(this->ticks);
     }
+    inline void Pong::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->ticks);
+    }
     inline int Pong::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -933,6 +1348,35 @@ namespace Generic
         if (int r = bb.Read(this->ticks)) return r;
         return 0;
     }
+    inline int Pong::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int Pong::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        return 0;
+    }
+    inline int Pong::Read_ticks(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Pong::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.Pong\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Pong::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"ticks\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Pong::ToString(xx::String& s) const noexcept
     {
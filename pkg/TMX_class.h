@@ -108,10 +108,32 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Map* const& o) const noexcept;
         Map* MakeCopy() const noexcept;
         Map_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_version(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_tiledversion(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_orientation(xx::BBuffer& bb, TMX::OrientationTypes& out) noexcept;
+        static int Read_renderorder(xx::BBuffer& bb, TMX::RenderOrderTypes& out) noexcept;
+        static int Read_width(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_height(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_tilewidth(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_tileheight(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_hexsidelength(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_infinite(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_nextlayerid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_nextobjectid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_backgroundcolor(xx::BBuffer& bb, TMX::Color4B& out) noexcept;
+        static int Read_tilesets(xx::BBuffer& bb, xx::List_p<TMX::TileSet_p>& out) noexcept;
+        static int Read_layers(xx::BBuffer& bb, xx::List_p<TMX::Layer_p>& out) noexcept;
+        static int Read_objectgroups(xx::BBuffer& bb, xx::List_p<TMX::ObjectGroup_p>& out) noexcept;
+        static int Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept;
     };
     class Property : public xx::Object
     {
@@ -130,10 +152,17 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Property* const& o) const noexcept;
         Property* MakeCopy() const noexcept;
         Property_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_value(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     class TileSet : public xx::Object
     {
@@ -164,10 +193,29 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(TileSet* const& o) const noexcept;
         TileSet* MakeCopy() const noexcept;
         TileSet_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_firstgid(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_tilewidth(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_tileheight(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_spacing(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_margin(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_tilecount(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_columns(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_tileoffsetx(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_tileoffsety(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_source(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_width(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_height(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_trans(xx::BBuffer& bb, TMX::Color4B& out) noexcept;
     };
     class Layer : public xx::Object
     {
@@ -193,10 +241,24 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Layer* const& o) const noexcept;
         Layer* MakeCopy() const noexcept;
         Layer_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_width(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_height(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_opacity(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_visible(xx::BBuffer& bb, bool& out) noexcept;
+        static int Read_offsetx(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_offsety(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_data(xx::BBuffer& bb, xx::List_p<TMX::Tile_p>& out) noexcept;
     };
     class Tile : public xx::Object
     {
@@ -214,10 +276,16 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Tile* const& o) const noexcept;
         Tile* MakeCopy() const noexcept;
         Tile_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_gid(xx::BBuffer& bb, int32_t& out) noexcept;
     };
     class ObjectGroup : public xx::Object
     {
@@ -244,10 +312,25 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(ObjectGroup* const& o) const noexcept;
         ObjectGroup* MakeCopy() const noexcept;
         ObjectGroup_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_color(xx::BBuffer& bb, TMX::Color4B& out) noexcept;
+        static int Read_opacity(xx::BBuffer& bb, std::optional<double>& out) noexcept;
+        static int Read_visible(xx::BBuffer& bb, std::optional<bool>& out) noexcept;
+        static int Read_offsetx(xx::BBuffer& bb, std::optional<double>& out) noexcept;
+        static int Read_offsety(xx::BBuffer& bb, std::optional<double>& out) noexcept;
+        static int Read_draworder(xx::BBuffer& bb, TMX::DrawOrderTypes& out) noexcept;
+        static int Read_objects(xx::BBuffer& bb, xx::List_p<TMX::Object_p>& out) noexcept;
+        static int Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept;
     };
     class Object : public xx::Object
     {
@@ -276,10 +359,27 @@ namespace TMX
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Object* const& o) const noexcept;
         Object* MakeCopy() const noexcept;
         Object_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_gid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept;
+        static int Read_x(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_y(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_width(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_height(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_type(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_text(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_visible(xx::BBuffer& bb, bool& out) noexcept;
+        static int Read_rotation(xx::BBuffer& bb, double& out) noexcept;
+        static int Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept;
     };
 }
 namespace xx
@@ -295,6 +395,14 @@ namespace xx
 		{
 			return bb.Read(out.r, out.g, out.b, out.a);
 		}
+		static inline void CalcLen(BBuffer& bb, TMX::Color4B const& in, size_t& len) noexcept
+		{
+			bb.CalcLen(len, in.r, in.g, in.b, in.a);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return bb.Skip<uint8_t, uint8_t, uint8_t, uint8_t>();
+		}
 	};
 	template<>
 	struct StrFunc<TMX::Color4B, void>
@@ -304,6 +412,24 @@ namespace xx
 			s.Append("{ \"structTypeName\":\"Color4B\"", ", \"r\":", in.r, ", \"g\":", in.g, ", \"b\":", in.b, ", \"a\":", in.a, " }");
         }
     };
+	template<>
+	struct JsonFunc<TMX::Color4B, void>
+	{
+		static inline int WriteTo(BBuffer& bb, xx::String& s) noexcept
+		{
+			s.Append("{\"structTypeName\":\"Color4B\"");
+			s.Append(",\"r\":");
+			if (int r = JsonFunc<uint8_t>::WriteTo(bb, s)) return r;
+			s.Append(",\"g\":");
+			if (int r = JsonFunc<uint8_t>::WriteTo(bb, s)) return r;
+			s.Append(",\"b\":");
+			if (int r = JsonFunc<uint8_t>::WriteTo(bb, s)) return r;
+			s.Append(",\"a\":");
+			if (int r = JsonFunc<uint8_t>::WriteTo(bb, s)) return r;
+			s.Append('}');
+			return 0;
+		}
+	};
 	template<> struct TypeId<TMX::Map> { static const uint16_t value = 3; };
 	template<> struct TypeId<xx::List<TMX::TileSet_p>> { static const uint16_t value = 4; };
 	template<> struct TypeId<TMX::TileSet> { static const uint16_t value = 5; };
@@ -349,6 +475,26 @@ namespace TMX
         bb.Write(this->objectgroups);
         bb.Write(this->properties);
     }
+    inline void Map::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->version);
+        bb.CalcLen(len, this->tiledversion);
+        bb.CalcLen(len, this->orientation);
+        bb.CalcLen(len, this->renderorder);
+        bb.CalcLen(len, this->width);
+        bb.CalcLen(len, this->height);
+        bb.CalcLen(len, this->tilewidth);
+        bb.CalcLen(len, this->tileheight);
+        bb.CalcLen(len, this->hexsidelength);
+        bb.CalcLen(len, this->infinite);
+        bb.CalcLen(len, this->nextlayerid);
+        bb.CalcLen(len, this->nextobjectid);
+        bb.CalcLen(len, this->backgroundcolor);
+        bb.CalcLen(len, this->tilesets);
+        bb.CalcLen(len, this->layers);
+        bb.CalcLen(len, this->objectgroups);
+        bb.CalcLen(len, this->properties);
+    }
     inline int Map::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -380,6 +526,197 @@ namespace TMX
         if (int r = bb.Read(this->properties)) return r;
         return 0;
     }
+    inline int Map::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 17);
+    }
+    inline int Map::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<TMX::OrientationTypes>()) return r;
+        if (n == 3) return 0;
+        if (int r = bb.Skip<TMX::RenderOrderTypes>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 6) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 8) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 9) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 10) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 11) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 12) return 0;
+        if (int r = bb.Skip<TMX::Color4B>()) return r;
+        if (n == 13) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::TileSet_p>>()) return r;
+        if (n == 14) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Layer_p>>()) return r;
+        if (n == 15) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::ObjectGroup_p>>()) return r;
+        if (n == 16) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Property_p>>()) return r;
+        return 0;
+    }
+    inline int Map::Read_version(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::Read_tiledversion(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::Read_orientation(xx::BBuffer& bb, TMX::OrientationTypes& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_renderorder(xx::BBuffer& bb, TMX::RenderOrderTypes& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_width(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_height(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_tilewidth(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_tileheight(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_hexsidelength(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_infinite(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_nextlayerid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 10)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_nextobjectid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 11)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_backgroundcolor(xx::BBuffer& bb, TMX::Color4B& out) noexcept
+    {
+        if (int r = SkipFields(bb, 12)) return r;
+        return bb.Read(out);
+    }
+    inline int Map::Read_tilesets(xx::BBuffer& bb, xx::List_p<TMX::TileSet_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 13)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::Read_layers(xx::BBuffer& bb, xx::List_p<TMX::Layer_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 14)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::Read_objectgroups(xx::BBuffer& bb, xx::List_p<TMX::ObjectGroup_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 15)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 16)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Map::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Map\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Map::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"version\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"tiledversion\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"orientation\":");
+        if (int r = xx::JsonFunc<TMX::OrientationTypes>::WriteTo(bb, s)) return r;
+        s.Append(",\"renderorder\":");
+        if (int r = xx::JsonFunc<TMX::RenderOrderTypes>::WriteTo(bb, s)) return r;
+        s.Append(",\"width\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"height\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"tilewidth\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"tileheight\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"hexsidelength\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"infinite\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"nextlayerid\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"nextobjectid\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"backgroundcolor\":");
+        if (int r = xx::JsonFunc<TMX::Color4B>::WriteTo(bb, s)) return r;
+        s.Append(",\"tilesets\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::TileSet_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"layers\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Layer_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"objectgroups\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::ObjectGroup_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"properties\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Property_p>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Map::ToString(xx::String& s) const noexcept
     {
@@ -464,6 +801,11 @@ namespace TMX
         bb.Write(this->name);
         bb.Write(this->value);
     }
+    inline void Property::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->value);
+    }
     inline int Property::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -476,6 +818,50 @@ namespace TMX
         if (int r = bb.Read(this->value)) return r;
         return 0;
     }
+    inline int Property::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Property::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Property::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Property::Read_value(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Property::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Property\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Property::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"value\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Property::ToString(xx::String& s) const noexcept
     {
@@ -542,6 +928,23 @@ namespace TMX
         bb.Write(this->height);
         bb.Write(this->trans);
     }
+    inline void TileSet::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->firstgid);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->tilewidth);
+        bb.CalcLen(len, this->tileheight);
+        bb.CalcLen(len, this->spacing);
+        bb.CalcLen(len, this->margin);
+        bb.CalcLen(len, this->tilecount);
+        bb.CalcLen(len, this->columns);
+        bb.CalcLen(len, this->tileoffsetx);
+        bb.CalcLen(len, this->tileoffsety);
+        bb.CalcLen(len, this->source);
+        bb.CalcLen(len, this->width);
+        bb.CalcLen(len, this->height);
+        bb.CalcLen(len, this->trans);
+    }
     inline int TileSet::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -566,6 +969,158 @@ namespace TMX
         if (int r = bb.Read(this->trans)) return r;
         return 0;
     }
+    inline int TileSet::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 14);
+    }
+    inline int TileSet::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 3) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 6) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 8) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 9) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 10) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 11) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 12) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 13) return 0;
+        if (int r = bb.Skip<TMX::Color4B>()) return r;
+        return 0;
+    }
+    inline int TileSet::Read_firstgid(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_tilewidth(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_tileheight(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_spacing(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_margin(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_tilecount(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_columns(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_tileoffsetx(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_tileoffsety(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_source(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 10)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_width(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 11)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_height(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 12)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::Read_trans(xx::BBuffer& bb, TMX::Color4B& out) noexcept
+    {
+        if (int r = SkipFields(bb, 13)) return r;
+        return bb.Read(out);
+    }
+    inline int TileSet::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"TileSet\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int TileSet::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"firstgid\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"tilewidth\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"tileheight\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"spacing\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"margin\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"tilecount\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"columns\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"tileoffsetx\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"tileoffsety\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"source\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"width\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"height\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"trans\":");
+        if (int r = xx::JsonFunc<TMX::Color4B>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void TileSet::ToString(xx::String& s) const noexcept
     {
@@ -651,6 +1206,18 @@ namespace TMX
         bb.Write(this->offsety);
         bb.Write(this->data);
     }
+    inline void Layer::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->width);
+        bb.CalcLen(len, this->height);
+        bb.CalcLen(len, this->opacity);
+        bb.CalcLen(len, this->visible);
+        bb.CalcLen(len, this->offsetx);
+        bb.CalcLen(len, this->offsety);
+        bb.CalcLen(len, this->data);
+    }
     inline int Layer::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -670,6 +1237,113 @@ namespace TMX
         if (int r = bb.Read(this->data)) return r;
         return 0;
     }
+    inline int Layer::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 9);
+    }
+    inline int Layer::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 3) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<bool>()) return r;
+        if (n == 6) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 8) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Tile_p>>()) return r;
+        return 0;
+    }
+    inline int Layer::Read_id(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_width(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_height(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_opacity(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_visible(xx::BBuffer& bb, bool& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_offsetx(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_offsety(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int Layer::Read_data(xx::BBuffer& bb, xx::List_p<TMX::Tile_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Layer::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Layer\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Layer::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"width\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"height\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"opacity\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"visible\":");
+        if (int r = xx::JsonFunc<bool>::WriteTo(bb, s)) return r;
+        s.Append(",\"offsetx\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"offsety\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"data\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Tile_p>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Layer::ToString(xx::String& s) const noexcept
     {
@@ -736,6 +1410,10 @@ namespace TMX
     {
         bb.Write(this->gid);
     }
+    inline void Tile::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->gid);
+    }
     inline int Tile::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -745,6 +1423,35 @@ namespace TMX
         if (int r = bb.Read(this->gid)) return r;
         return 0;
     }
+    inline int Tile::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int Tile::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int Tile::Read_gid(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Tile::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tile\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Tile::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"gid\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Tile::ToString(xx::String& s) const noexcept
     {
@@ -803,6 +1510,19 @@ namespace TMX
         bb.Write(this->objects);
         bb.Write(this->properties);
     }
+    inline void ObjectGroup::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->color);
+        bb.CalcLen(len, this->opacity);
+        bb.CalcLen(len, this->visible);
+        bb.CalcLen(len, this->offsetx);
+        bb.CalcLen(len, this->offsety);
+        bb.CalcLen(len, this->draworder);
+        bb.CalcLen(len, this->objects);
+        bb.CalcLen(len, this->properties);
+    }
     inline int ObjectGroup::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -824,6 +1544,125 @@ namespace TMX
         if (int r = bb.Read(this->properties)) return r;
         return 0;
     }
+    inline int ObjectGroup::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 10);
+    }
+    inline int ObjectGroup::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<TMX::Color4B>()) return r;
+        if (n == 3) return 0;
+        if (int r = bb.Skip<std::optional<double>>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<std::optional<bool>>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<std::optional<double>>()) return r;
+        if (n == 6) return 0;
+        if (int r = bb.Skip<std::optional<double>>()) return r;
+        if (n == 7) return 0;
+        if (int r = bb.Skip<TMX::DrawOrderTypes>()) return r;
+        if (n == 8) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Object_p>>()) return r;
+        if (n == 9) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Property_p>>()) return r;
+        return 0;
+    }
+    inline int ObjectGroup::Read_id(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_color(xx::BBuffer& bb, TMX::Color4B& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_opacity(xx::BBuffer& bb, std::optional<double>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_visible(xx::BBuffer& bb, std::optional<bool>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_offsetx(xx::BBuffer& bb, std::optional<double>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_offsety(xx::BBuffer& bb, std::optional<double>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_draworder(xx::BBuffer& bb, TMX::DrawOrderTypes& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_objects(xx::BBuffer& bb, xx::List_p<TMX::Object_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int ObjectGroup::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"ObjectGroup\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int ObjectGroup::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"color\":");
+        if (int r = xx::JsonFunc<TMX::Color4B>::WriteTo(bb, s)) return r;
+        s.Append(",\"opacity\":");
+        if (int r = xx::JsonFunc<std::optional<double>>::WriteTo(bb, s)) return r;
+        s.Append(",\"visible\":");
+        if (int r = xx::JsonFunc<std::optional<bool>>::WriteTo(bb, s)) return r;
+        s.Append(",\"offsetx\":");
+        if (int r = xx::JsonFunc<std::optional<double>>::WriteTo(bb, s)) return r;
+        s.Append(",\"offsety\":");
+        if (int r = xx::JsonFunc<std::optional<double>>::WriteTo(bb, s)) return r;
+        s.Append(",\"draworder\":");
+        if (int r = xx::JsonFunc<TMX::DrawOrderTypes>::WriteTo(bb, s)) return r;
+        s.Append(",\"objects\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Object_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"properties\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Property_p>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void ObjectGroup::ToString(xx::String& s) const noexcept
     {
@@ -903,6 +1742,21 @@ namespace TMX
         bb.Write(this->rotation);
         bb.Write(this->properties);
     }
+    inline void Object::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->gid);
+        bb.CalcLen(len, this->x);
+        bb.CalcLen(len, this->y);
+        bb.CalcLen(len, this->width);
+        bb.CalcLen(len, this->height);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->type);
+        bb.CalcLen(len, this->text);
+        bb.CalcLen(len, this->visible);
+        bb.CalcLen(len, this->rotation);
+        bb.CalcLen(len, this->properties);
+    }
     inline int Object::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -927,6 +1781,146 @@ namespace TMX
         if (int r = bb.Read(this->properties)) return r;
         return 0;
     }
+    inline int Object::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 12);
+    }
+    inline int Object::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        if (int r = bb.Skip<std::optional<int32_t>>()) return r;
+        if (n == 2) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 3) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 4) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 5) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 6) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 7) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 8) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 9) return 0;
+        if (int r = bb.Skip<bool>()) return r;
+        if (n == 10) return 0;
+        if (int r = bb.Skip<double>()) return r;
+        if (n == 11) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<TMX::Property_p>>()) return r;
+        return 0;
+    }
+    inline int Object::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_gid(xx::BBuffer& bb, std::optional<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_x(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_y(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_width(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_height(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Object::Read_type(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Object::Read_text(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 8)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Object::Read_visible(xx::BBuffer& bb, bool& out) noexcept
+    {
+        if (int r = SkipFields(bb, 9)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_rotation(xx::BBuffer& bb, double& out) noexcept
+    {
+        if (int r = SkipFields(bb, 10)) return r;
+        return bb.Read(out);
+    }
+    inline int Object::Read_properties(xx::BBuffer& bb, xx::List_p<TMX::Property_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 11)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Object::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Object\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Object::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"gid\":");
+        if (int r = xx::JsonFunc<std::optional<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"x\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"y\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"width\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"height\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"type\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"text\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"visible\":");
+        if (int r = xx::JsonFunc<bool>::WriteTo(bb, s)) return r;
+        s.Append(",\"rotation\":");
+        if (int r = xx::JsonFunc<double>::WriteTo(bb, s)) return r;
+        s.Append(",\"properties\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<TMX::Property_p>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Object::ToString(xx::String& s) const noexcept
     {
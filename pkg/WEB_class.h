@@ -113,10 +113,16 @@ namespace WEB_testcpp3
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(AuthInfo* const& o) const noexcept;
         AuthInfo* MakeCopy() const noexcept;
         AuthInfo_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
     };
 }
 namespace Tables
@@ -140,10 +146,18 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(manager* const& o) const noexcept;
         manager* MakeCopy() const noexcept;
         manager_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     // 管理人员_身份_绑定表
     class manager_role : public xx::Object
@@ -163,10 +177,17 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(manager_role* const& o) const noexcept;
         manager_role* MakeCopy() const noexcept;
         manager_role_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_manager_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_role_id(xx::BBuffer& bb, int32_t& out) noexcept;
     };
     // 权限表
     class permission : public xx::Object
@@ -188,10 +209,19 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(permission* const& o) const noexcept;
         permission* MakeCopy() const noexcept;
         permission_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_group(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     // 管理人员身份表
     class role : public xx::Object
@@ -212,10 +242,18 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(role* const& o) const noexcept;
         role* MakeCopy() const noexcept;
         role_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     // 身份_权限_绑定表
     class role_permission : public xx::Object
@@ -235,10 +273,17 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(role_permission* const& o) const noexcept;
         role_permission* MakeCopy() const noexcept;
         role_permission_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_role_id(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_permission_id(xx::BBuffer& bb, int32_t& out) noexcept;
     };
 }
     // 管理人员
@@ -261,10 +306,17 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Manager* const& o) const noexcept;
         Manager* MakeCopy() const noexcept;
         Manager_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_token(xx::BBuffer& bb, xx::String_p& out) noexcept;
+        static int Read_lastVisitTime(xx::BBuffer& bb, int64_t& out) noexcept;
     };
     // 身份
     class Role : public WEB::Tables::role
@@ -282,10 +334,15 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Role* const& o) const noexcept;
         Role* MakeCopy() const noexcept;
         Role_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
     // 权限
     class Permission : public WEB::Tables::permission
@@ -303,10 +360,15 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Permission* const& o) const noexcept;
         Permission* MakeCopy() const noexcept;
         Permission_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
     // 管理人员_身份_绑定
     class BindManagerRole : public WEB::Tables::manager_role
@@ -324,10 +386,15 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(BindManagerRole* const& o) const noexcept;
         BindManagerRole* MakeCopy() const noexcept;
         BindManagerRole_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
     // 身份_权限_绑定
     class BindRolePermission : public WEB::Tables::role_permission
@@ -345,10 +412,15 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(BindRolePermission* const& o) const noexcept;
         BindRolePermission* MakeCopy() const noexcept;
         BindRolePermission_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
     class SomeLists : public xx::Object
     {
@@ -373,10 +445,23 @@ namespace Tables
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(SomeLists* const& o) const noexcept;
         SomeLists* MakeCopy() const noexcept;
         SomeLists_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_ints(xx::BBuffer& bb, xx::List_p<int32_t>& out) noexcept;
+        static int Read_longs(xx::BBuffer& bb, xx::List_p<int64_t>& out) noexcept;
+        static int Read_strings(xx::BBuffer& bb, xx::List_p<xx::String_p>& out) noexcept;
+        static int Read_Managers(xx::BBuffer& bb, xx::List_p<WEB::Manager_p>& out) noexcept;
+        static int Read_Roles(xx::BBuffer& bb, xx::List_p<WEB::Role_p>& out) noexcept;
+        static int Read_Permissions(xx::BBuffer& bb, xx::List_p<WEB::Permission_p>& out) noexcept;
+        static int Read_BindManagerRoles(xx::BBuffer& bb, xx::List_p<WEB::BindManagerRole_p>& out) noexcept;
+        static int Read_BindRolePermissions(xx::BBuffer& bb, xx::List_p<WEB::BindRolePermission_p>& out) noexcept;
     };
 namespace Generic
 {
@@ -398,10 +483,17 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Error* const& o) const noexcept;
         Error* MakeCopy() const noexcept;
         Error_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int Read_errNum(xx::BBuffer& bb, int32_t& out) noexcept;
+        static int Read_errMsg(xx::BBuffer& bb, xx::String_p& out) noexcept;
     };
     // 默认 rpc 成功返回
     class Success : public xx::Object
@@ -419,10 +511,15 @@ namespace Generic
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Success* const& o) const noexcept;
         Success* MakeCopy() const noexcept;
         Success_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
 }
 namespace WEB_testcpp3
@@ -442,10 +539,15 @@ namespace WEB_testcpp3
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Cmd1* const& o) const noexcept;
         Cmd1* MakeCopy() const noexcept;
         Cmd1_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
     class Cmd2 : public WEB::WEB_testcpp3::AuthInfo
     {
@@ -462,10 +564,15 @@ namespace WEB_testcpp3
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(Cmd2* const& o) const noexcept;
         Cmd2* MakeCopy() const noexcept;
         Cmd2_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;
     };
 }
 }
@@ -513,6 +620,12 @@ namespace WEB
         bb.Write(this->token);
         bb.Write(this->lastVisitTime);
     }
+    inline void Manager::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+        bb.CalcLen(len, this->token);
+        bb.CalcLen(len, this->lastVisitTime);
+    }
     inline int Manager::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -525,6 +638,48 @@ namespace WEB
         if (int r = bb.Read(this->lastVisitTime)) return r;
         return 0;
     }
+    inline int Manager::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Manager::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 1) return 0;
+        if (int r = bb.Skip<int64_t>()) return r;
+        return 0;
+    }
+    inline int Manager::Read_token(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Manager::Read_lastVisitTime(xx::BBuffer& bb, int64_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        return bb.Read(out);
+    }
+    inline int Manager::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Manager\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Manager::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"token\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"lastVisitTime\":");
+        if (int r = xx::JsonFunc<int64_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Manager::ToString(xx::String& s) const noexcept
     {
@@ -578,6 +733,10 @@ namespace WEB
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void Role::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int Role::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -587,6 +746,27 @@ namespace WEB
     {
         return 0;
     }
+    inline int Role::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int Role::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int Role::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Role\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Role::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void Role::ToString(xx::String& s) const noexcept
     {
@@ -635,6 +815,10 @@ namespace WEB
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void Permission::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int Permission::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -644,6 +828,27 @@ namespace WEB
     {
         return 0;
     }
+    inline int Permission::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int Permission::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int Permission::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Permission\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Permission::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void Permission::ToString(xx::String& s) const noexcept
     {
@@ -692,6 +897,10 @@ namespace WEB
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void BindManagerRole::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int BindManagerRole::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -701,6 +910,27 @@ namespace WEB
     {
         return 0;
     }
+    inline int BindManagerRole::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int BindManagerRole::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int BindManagerRole::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"BindManagerRole\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int BindManagerRole::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void BindManagerRole::ToString(xx::String& s) const noexcept
     {
@@ -749,6 +979,10 @@ namespace WEB
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void BindRolePermission::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int BindRolePermission::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -758,6 +992,27 @@ namespace WEB
     {
         return 0;
     }
+    inline int BindRolePermission::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int BindRolePermission::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int BindRolePermission::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"BindRolePermission\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int BindRolePermission::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void BindRolePermission::ToString(xx::String& s) const noexcept
     {
@@ -813,6 +1068,17 @@ namespace WEB
         bb.Write(this->BindManagerRoles);
         bb.Write(this->BindRolePermissions);
     }
+    inline void SomeLists::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->ints);
+        bb.CalcLen(len, this->longs);
+        bb.CalcLen(len, this->strings);
+        bb.CalcLen(len, this->Managers);
+        bb.CalcLen(len, this->Roles);
+        bb.CalcLen(len, this->Permissions);
+        bb.CalcLen(len, this->BindManagerRoles);
+        bb.CalcLen(len, this->BindRolePermissions);
+    }
     inline int SomeLists::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -837,6 +1103,122 @@ namespace WEB
         if (int r = bb.Read(this->BindRolePermissions)) return r;
         return 0;
     }
+    inline int SomeLists::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 8);
+    }
+    inline int SomeLists::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<int32_t>>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<int64_t>>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<xx::String_p>>()) return r;
+        if (n == 3) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<WEB::Manager_p>>()) return r;
+        if (n == 4) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<WEB::Role_p>>()) return r;
+        if (n == 5) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<WEB::Permission_p>>()) return r;
+        if (n == 6) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<WEB::BindManagerRole_p>>()) return r;
+        if (n == 7) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::List_p<WEB::BindRolePermission_p>>()) return r;
+        return 0;
+    }
+    inline int SomeLists::Read_ints(xx::BBuffer& bb, xx::List_p<int32_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_longs(xx::BBuffer& bb, xx::List_p<int64_t>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_strings(xx::BBuffer& bb, xx::List_p<xx::String_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_Managers(xx::BBuffer& bb, xx::List_p<WEB::Manager_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_Roles(xx::BBuffer& bb, xx::List_p<WEB::Role_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 4)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_Permissions(xx::BBuffer& bb, xx::List_p<WEB::Permission_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 5)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_BindManagerRoles(xx::BBuffer& bb, xx::List_p<WEB::BindManagerRole_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 6)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::Read_BindRolePermissions(xx::BBuffer& bb, xx::List_p<WEB::BindRolePermission_p>& out) noexcept
+    {
+        if (int r = SkipFields(bb, 7)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int SomeLists::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"SomeLists\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int SomeLists::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"ints\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<int32_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"longs\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<int64_t>>::WriteTo(bb, s)) return r;
+        s.Append(",\"strings\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<xx::String_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"Managers\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<WEB::Manager_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"Roles\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<WEB::Role_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"Permissions\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<WEB::Permission_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"BindManagerRoles\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<WEB::BindManagerRole_p>>::WriteTo(bb, s)) return r;
+        s.Append(",\"BindRolePermissions\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::List_p<WEB::BindRolePermission_p>>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void SomeLists::ToString(xx::String& s) const noexcept
     {
@@ -903,6 +1285,11 @@ namespace Generic
         bb.Write(this->errNum);
         bb.Write(this->errMsg);
     }
+    inline void Error::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->errNum);
+        bb.CalcLen(len, this->errMsg);
+    }
     inline int Error::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -914,6 +1301,47 @@ namespace Generic
         if (int r = bb.Read(this->errMsg)) return r;
         return 0;
     }
+    inline int Error::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int Error::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int Error::Read_errNum(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int Error::Read_errMsg(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int Error::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.Error\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Error::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"errNum\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"errMsg\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void Error::ToString(xx::String& s) const noexcept
     {
@@ -965,6 +1393,9 @@ namespace Generic
     inline void Success::ToBBuffer(xx::BBuffer& bb) const noexcept
     {
     }
+    inline void Success::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+    }
     inline int Success::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -973,6 +1404,26 @@ namespace Generic
     {
         return 0;
     }
+    inline int Success::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int Success::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        return 0;
+    }
+    inline int Success::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Generic.Success\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Success::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void Success::ToString(xx::String& s) const noexcept
     {
@@ -1023,6 +1474,10 @@ namespace WEB_testcpp3
     {
         bb.Write(this->id);
     }
+    inline void AuthInfo::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+    }
     inline int AuthInfo::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1032,6 +1487,35 @@ namespace WEB_testcpp3
         if (int r = bb.Read(this->id)) return r;
         return 0;
     }
+    inline int AuthInfo::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 1);
+    }
+    inline int AuthInfo::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int AuthInfo::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int AuthInfo::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"WEB_testcpp3.AuthInfo\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int AuthInfo::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void AuthInfo::ToString(xx::String& s) const noexcept
     {
@@ -1081,6 +1565,10 @@ namespace WEB_testcpp3
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void Cmd1::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int Cmd1::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -1090,6 +1578,27 @@ namespace WEB_testcpp3
     {
         return 0;
     }
+    inline int Cmd1::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int Cmd1::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int Cmd1::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"WEB_testcpp3.Cmd1\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Cmd1::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void Cmd1::ToString(xx::String& s) const noexcept
     {
@@ -1138,6 +1647,10 @@ namespace WEB_testcpp3
     {
         this->BaseType::ToBBuffer(bb);
     }
+    inline void Cmd2::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        this->BaseType::CalcBBufferLen(bb, len);
+    }
     inline int Cmd2::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         if (int r = this->BaseType::FromBBuffer(bb)) return r;
@@ -1147,6 +1660,27 @@ namespace WEB_testcpp3
     {
         return 0;
     }
+    inline int Cmd2::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 0);
+    }
+    inline int Cmd2::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (int r = BaseType::SkipBBuffer(bb)) return r;
+        return 0;
+    }
+    inline int Cmd2::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"WEB_testcpp3.Cmd2\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int Cmd2::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        return 0;
+    }
 
     inline void Cmd2::ToString(xx::String& s) const noexcept
     {
@@ -1200,6 +1734,12 @@ namespace Tables
         bb.Write(this->username);
         bb.Write(this->password);
     }
+    inline void manager::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->username);
+        bb.CalcLen(len, this->password);
+    }
     inline int manager::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1213,6 +1753,59 @@ namespace Tables
         if (int r = bb.Read(this->password)) return r;
         return 0;
     }
+    inline int manager::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 3);
+    }
+    inline int manager::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int manager::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int manager::Read_username(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int manager::Read_password(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int manager::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.manager\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int manager::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"username\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"password\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void manager::ToString(xx::String& s) const noexcept
     {
@@ -1269,6 +1862,11 @@ namespace Tables
         bb.Write(this->manager_id);
         bb.Write(this->role_id);
     }
+    inline void manager_role::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->manager_id);
+        bb.CalcLen(len, this->role_id);
+    }
     inline int manager_role::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1279,6 +1877,44 @@ namespace Tables
         if (int r = bb.Read(this->role_id)) return r;
         return 0;
     }
+    inline int manager_role::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int manager_role::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int manager_role::Read_manager_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int manager_role::Read_role_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        return bb.Read(out);
+    }
+    inline int manager_role::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.manager_role\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int manager_role::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"manager_id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"role_id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void manager_role::ToString(xx::String& s) const noexcept
     {
@@ -1333,6 +1969,13 @@ namespace Tables
         bb.Write(this->name);
         bb.Write(this->desc);
     }
+    inline void permission::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->group);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->desc);
+    }
     inline int permission::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1348,6 +1991,71 @@ namespace Tables
         if (int r = bb.Read(this->desc)) return r;
         return 0;
     }
+    inline int permission::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 4);
+    }
+    inline int permission::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 3) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int permission::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int permission::Read_group(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int permission::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int permission::Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 3)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int permission::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.permission\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int permission::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"group\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"desc\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void permission::ToString(xx::String& s) const noexcept
     {
@@ -1408,6 +2116,12 @@ namespace Tables
         bb.Write(this->name);
         bb.Write(this->desc);
     }
+    inline void role::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->id);
+        bb.CalcLen(len, this->name);
+        bb.CalcLen(len, this->desc);
+    }
     inline int role::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1421,6 +2135,59 @@ namespace Tables
         if (int r = bb.Read(this->desc)) return r;
         return 0;
     }
+    inline int role::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 3);
+    }
+    inline int role::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        if (n == 2) return 0;
+        bb.readLengthLimit = 0;
+        if (int r = bb.Skip<xx::String_p>()) return r;
+        return 0;
+    }
+    inline int role::Read_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int role::Read_name(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int role::Read_desc(xx::BBuffer& bb, xx::String_p& out) noexcept
+    {
+        if (int r = SkipFields(bb, 2)) return r;
+        bb.readLengthLimit = 0;
+        return bb.Read(out);
+    }
+    inline int role::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.role\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int role::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"name\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        s.Append(",\"desc\":");
+        bb.readLengthLimit = 0;
+        if (int r = xx::JsonFunc<xx::String_p>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void role::ToString(xx::String& s) const noexcept
     {
@@ -1477,6 +2244,11 @@ namespace Tables
         bb.Write(this->role_id);
         bb.Write(this->permission_id);
     }
+    inline void role_permission::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {
+        bb.CalcLen(len, this->role_id);
+        bb.CalcLen(len, this->permission_id);
+    }
     inline int role_permission::FromBBuffer(xx::BBuffer& bb) noexcept
     {
         return this->FromBBufferCore(bb);
@@ -1487,6 +2259,44 @@ namespace Tables
         if (int r = bb.Read(this->permission_id)) return r;
         return 0;
     }
+    inline int role_permission::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, 2);
+    }
+    inline int role_permission::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {
+        if (n == 0) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        if (n == 1) return 0;
+        if (int r = bb.Skip<int32_t>()) return r;
+        return 0;
+    }
+    inline int role_permission::Read_role_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 0)) return r;
+        return bb.Read(out);
+    }
+    inline int role_permission::Read_permission_id(xx::BBuffer& bb, int32_t& out) noexcept
+    {
+        if (int r = SkipFields(bb, 1)) return r;
+        return bb.Read(out);
+    }
+    inline int role_permission::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append("{\"pkgTypeName\":\"Tables.role_permission\",\"pkgTypeId\":", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int role_permission::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;
+        s.Append(",\"role_id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        s.Append(",\"permission_id\":");
+        if (int r = xx::JsonFunc<int32_t>::WriteTo(bb, s)) return r;
+        return 0;
+    }
 
     inline void role_permission::ToString(xx::String& s) const noexcept
     {
@@ -188,7 +188,7 @@ namespace " + c.Namespace.Replace(".", "::") + @"
             foreach (var f in fs)
             {
                 var ft = f.FieldType;
-                var ftn = ft._GetTypeDecl_Cpp(templateName, "_p");
+                var ftn = _GetFieldTypeDecl_Cpp(f, templateName);
                 sb.Append(f._GetDesc()._GetComment_Cpp(8) + @"
         " + (f.IsStatic ? "constexpr " : "") + ftn + " " + f.Name);
 
@@ -224,10 +224,30 @@ namespace " + c.Namespace.Replace(".", "::") + @"
         void ToBBuffer(xx::BBuffer& bb) const noexcept override;
         int FromBBuffer(xx::BBuffer& bb) noexcept override;
         int FromBBufferCore(xx::BBuffer& bb) noexcept;
+        void CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept override;
         void CopyTo(" + c.Name + @"* const& o) const noexcept;
         " + c.Name + @"* MakeCopy() const noexcept;
         " + c.Name + @"_p MakePtrCopy() const noexcept;
         inline static xx::Ptr<ThisType> defaultInstance;
+        static int SkipBBuffer(xx::BBuffer& bb) noexcept;
+        static int SkipFields(xx::BBuffer& bb, size_t const& n) noexcept;
+        static int WriteJson(xx::BBuffer& bb, xx::String& s) noexcept;
+        static int WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept;");
+
+            // 按需解码单个成员( bb.offset 需指向本类数据起始处 )
+            foreach (var f in c._GetFields())
+            {
+                if (f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) continue;
+                sb.Append(@"
+        static int Read_" + f.Name + @"(xx::BBuffer& bb, " + _GetFieldTypeDecl_Cpp(f, templateName) + @"& out) noexcept;");
+            }
+            if (c._IsDelta())
+            {
+                sb.Append(@"
+        void WriteDelta(xx::BBuffer& bb, " + c.Name + @" const& base) const noexcept;
+        int ReadDelta(xx::BBuffer& bb, " + c.Name + @" const& base) noexcept;");
+            }
+            sb.Append(@"
     };");   // class }
 
             // namespace }
@@ -279,6 +299,32 @@ namespace xx
             }
             sb.Append(@");
 		}
+		static inline void CalcLen(BBuffer& bb, " + ctn + @" const& in, size_t& len) noexcept
+		{
+			bb.CalcLen(len");
+            foreach (var f in fs)
+            {
+                if (!f._Has<TemplateLibrary.NotSerialize>())
+                {
+                    sb.Append(@", in." + f.Name);
+                }
+            }
+            sb.Append(@");
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return bb.Skip<");
+            var first = true;
+            foreach (var f in fs)
+            {
+                if (!f._Has<TemplateLibrary.NotSerialize>())
+                {
+                    sb.Append((first ? "" : ", ") + f.FieldType._GetTypeDecl_Cpp(templateName));
+                    first = false;
+                }
+            }
+            sb.Append(@">();
+		}
 	};
 	template<>
 	struct StrFunc<" + ctn + @", void>
@@ -292,7 +338,25 @@ namespace xx
             }
             sb.Append(@", "" }"");
         }
-    };");
+    };
+	template<>
+	struct JsonFunc<" + ctn + @", void>
+	{
+		static inline int WriteTo(BBuffer& bb, xx::String& s) noexcept
+		{
+			s.Append(""{\""structTypeName\"":\""" + (string.IsNullOrEmpty(c.Namespace) ? c.Name : c.Namespace + "." + c.Name) + @"\"""");");
+            foreach (var f in fs)
+            {
+                if (f._Has<TemplateLibrary.NotSerialize>()) continue;
+                sb.Append(@"
+			s.Append("",\""" + f.Name + @"\"":"");
+			if (int r = JsonFunc<" + f.FieldType._GetTypeDecl_Cpp(templateName) + @">::WriteTo(bb, s)) return r;");
+            }
+            sb.Append(@"
+			s.Append('}');
+			return 0;
+		}
+	};");
 
         }
 
@@ -310,6 +374,11 @@ namespace xx
 
             sb.Append(@"
 	template<> struct TypeId<" + ctn + @"> { static const uint16_t value = " + typeId + @"; };");
+            if (ct._IsTree(asm))
+            {
+                sb.Append(@"
+	template<> struct IsTree<" + ctn + @"> { static const bool value = true; };");
+            }
         }
 
         sb.Append(@"
@@ -370,6 +439,13 @@ namespace " + c.Namespace.Replace(".", "::") + @"
                 {
                     sb.Append(@"
         bb.CustomWrite(bb, (void*)this, _offsetof(ThisType, " + f.Name + "));");
+                }
+                else if (f._IsPacked())
+                {
+                    sb.Append(@"
+        bb.packedList = true;
+        bb.Write(this->" + f.Name + @");
+        bb.packedList = false;");
                 }
                 else
                 {
@@ -380,6 +456,44 @@ namespace " + c.Namespace.Replace(".", "::") + @"
 
             sb.Append(@"
     }
+    inline void " + c.Name + @"::CalcBBufferLen(xx::BBuffer& bb, size_t& len) const noexcept
+    {");
+
+            if (c._HasBaseType())
+            {
+                sb.Append(@"
+        this->BaseType::CalcBBufferLen(bb, len);");
+            }
+            foreach (var f in fs)
+            {
+                var ft = f.FieldType;
+                if (ft._IsExternal() && !ft._GetExternalSerializable()) continue;
+                if (f._Has<TemplateLibrary.NotSerialize>())
+                {
+                    sb.Append(@"
+        bb.CalcLen(len, " + ft._GetTypeDecl_Cpp(templateName, "_p") + "());");
+                }
+                else if (f._Has<TemplateLibrary.CustomSerialize>())
+                {
+                    sb.Append(@"
+        // " + f.Name + " 由 CustomWrite 写入, 长度无法预算");
+                }
+                else if (f._IsPacked())
+                {
+                    sb.Append(@"
+        bb.packedList = true;
+        bb.CalcLen(len, this->" + f.Name + @");
+        bb.packedList = false;");
+                }
+                else
+                {
+                    sb.Append(@"
+        bb.CalcLen(len, this->" + f.Name + ");");
+                }
+            }
+
+            sb.Append(@"
+    }
     inline int " + c.Name + @"::FromBBuffer(xx::BBuffer& bb) noexcept
     {");
             if (c._HasBaseType())
@@ -396,18 +510,121 @@ namespace " + c.Namespace.Replace(".", "::") + @"
             foreach (var f in fs)
             {
                 if (f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) continue;
-                if (f.FieldType._IsContainer())
-                {
-                    sb.Append(@"
-        bb.readLengthLimit = " + f._GetLimit() + ";");
-                }
-
+                sb.Append(_GetReadFlags_Cpp(f));
                 sb.Append(@"
         if (int r = bb.Read(this->" + f.Name + @")) return r;");
+                sb.Append(_GetReadFlagsReset_Cpp(f));
             }
             sb.Append(@"
         return 0;
     }
+    inline int " + c.Name + @"::SkipBBuffer(xx::BBuffer& bb) noexcept
+    {
+        return SkipFields(bb, " + fs.Count(f => !f.FieldType._IsExternal() || f.FieldType._GetExternalSerializable()) + @");
+    }
+    inline int " + c.Name + @"::SkipFields(xx::BBuffer& bb, size_t const& n) noexcept
+    {");
+            if (c._HasBaseType())
+            {
+                sb.Append(@"
+        if (int r = BaseType::SkipBBuffer(bb)) return r;");
+            }
+            var fi = 0;
+            foreach (var f in fs)
+            {
+                if (f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) continue;
+                sb.Append(@"
+        if (n == " + fi++ + @") return 0;");
+                sb.Append(_GetReadFlags_Cpp(f));
+                sb.Append(@"
+        if (int r = bb.Skip<" + _GetFieldTypeDecl_Cpp(f, templateName) + @">()) return r;");
+                sb.Append(_GetReadFlagsReset_Cpp(f));
+            }
+            sb.Append(@"
+        return 0;
+    }");
+            fi = 0;
+            foreach (var f in fs)
+            {
+                if (f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) continue;
+                sb.Append(@"
+    inline int " + c.Name + @"::Read_" + f.Name + @"(xx::BBuffer& bb, " + _GetFieldTypeDecl_Cpp(f, templateName) + @"& out) noexcept
+    {
+        if (int r = SkipFields(bb, " + fi++ + @")) return r;" + _GetReadFlags_Cpp(f) + (f._IsPacked() ? @"
+        int r = bb.Read(out);" + _GetReadFlagsReset_Cpp(f) + @"
+        return r;
+    }" : @"
+        return bb.Read(out);
+    }"));
+            }
+
+            // 序列化数据直接转 json( 不创建对象 )
+            sb.Append(@"
+    inline int " + c.Name + @"::WriteJson(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        s.Append(""{\""pkgTypeName\"":\""" + (string.IsNullOrEmpty(c.Namespace) ? c.Name : c.Namespace + "." + c.Name) + @"\"",\""pkgTypeId\"":"", xx::TypeId_v<ThisType>);
+        if (int r = WriteJsonCore(bb, s)) return r;
+        s.Append('}');
+        return 0;
+    }
+    inline int " + c.Name + @"::WriteJsonCore(xx::BBuffer& bb, xx::String& s) noexcept
+    {
+        if (int r = BaseType::WriteJsonCore(bb, s)) return r;");
+            foreach (var f in fs)
+            {
+                if (f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) continue;
+                sb.Append(@"
+        s.Append("",\""" + f.Name + @"\"":"");" + _GetReadFlags_Cpp(f) + @"
+        if (int r = xx::JsonFunc<" + _GetFieldTypeDecl_Cpp(f, templateName) + @">::WriteTo(bb, s)) return r;");
+                sb.Append(_GetReadFlagsReset_Cpp(f));
+            }
+            sb.Append(@"
+        return 0;
+    }");
+
+            // 差量快照
+            if (c._IsDelta())
+            {
+                var dfs = fs.Where(f => !(f.FieldType._IsExternal() && !f.FieldType._GetExternalSerializable()) && !f._Has<TemplateLibrary.NotSerialize>()).ToList();
+                sb.Append(@"
+    inline void " + c.Name + @"::WriteDelta(xx::BBuffer& bb, " + c.Name + @" const& base) const noexcept
+    {");
+                if (c._HasBaseType())
+                {
+                    sb.Append(@"
+        this->BaseType::WriteDelta(bb, base);");
+                }
+                sb.Append(@"
+        xx::DeltaWriter dw(bb, " + dfs.Count + @");");
+                foreach (var f in dfs)
+                {
+                    var q = f._GetQuantize();
+                    sb.Append(@"
+        dw.Write(base." + f.Name + @", this->" + f.Name + (q > 0 ? ", " + q.ToString(System.Globalization.CultureInfo.InvariantCulture) : "") + @");");
+                }
+                sb.Append(@"
+    }
+    inline int " + c.Name + @"::ReadDelta(xx::BBuffer& bb, " + c.Name + @" const& base) noexcept
+    {");
+                if (c._HasBaseType())
+                {
+                    sb.Append(@"
+        if (int r = this->BaseType::ReadDelta(bb, base)) return r;");
+                }
+                sb.Append(@"
+        xx::DeltaReader dr(bb);
+        if (int r = dr.Begin(" + dfs.Count + @")) return r;");
+                foreach (var f in dfs)
+                {
+                    var q = f._GetQuantize();
+                    sb.Append(@"
+        if (int r = dr.Read(base." + f.Name + @", this->" + f.Name + (q > 0 ? ", " + q.ToString(System.Globalization.CultureInfo.InvariantCulture) : "") + @")) return r;");
+                }
+                sb.Append(@"
+        return 0;
+    }");
+            }
+            sb.Append(@"
 
     inline void " + c.Name + @"::ToString(xx::String& s) const noexcept
     {
@@ -509,4 +726,36 @@ namespace " + templateName + @"
 
         sb._WriteToFile(Path.Combine(outDir, templateName + "_class.h"));
     }
+
+    // 成员的 c++ 类型( 标记了 View 的 string / BBuffer 生成为视图 )
+    static string _GetFieldTypeDecl_Cpp(FieldInfo f, string templateName)
+    {
+        var ft = f.FieldType;
+        if (f._IsView()) return ft._IsString() ? "xx::StrView" : "xx::BufView";
+        return ft._GetTypeDecl_Cpp(templateName, "_p");
+    }
+
+    // 读成员之前 需设置的 bb 参数( 同 FromBBufferCore )
+    static string _GetReadFlags_Cpp(FieldInfo f)
+    {
+        var s = "";
+        if (f.FieldType._IsContainer())
+        {
+            s += @"
+        bb.readLengthLimit = " + f._GetLimit() + ";";
+        }
+        if (f._IsPacked())
+        {
+            s += @"
+        bb.packedList = true;";
+        }
+        return s;
+    }
+
+    // 读成员之后 需还原的 bb 参数( 空指针 / 已读过的指针 不会走到 List 的读函数, packedList 不会被消耗, 故需手动还原 )
+    static string _GetReadFlagsReset_Cpp(FieldInfo f)
+    {
+        return f._IsPacked() ? @"
+        bb.packedList = false;" : "";
+    }
 }
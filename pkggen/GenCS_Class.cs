@@ -166,6 +166,13 @@ namespace " + c.Namespace + @"
                 {
                     sb.Append(@"
             ((xx.IObject)this." + f.Name + ").ToBBuffer(bb);");
+                }
+                else if (f._IsPacked())
+                {
+                    sb.Append(@"
+            bb.packedList = true;
+            bb.Write(this." + f.Name + @");
+            bb.packedList = false;");
                 }
                 else
                 {
@@ -212,9 +219,19 @@ namespace " + c.Namespace + @"
                     {
                         sb.Append(@"
             bb.readLengthLimit = " + f._GetLimit() + ";");
+                    }
+                    if (f._IsPacked())
+                    {
+                        sb.Append(@"
+            bb.packedList = true;");
                     }
                     sb.Append(@"
             bb.Read(ref this." + f.Name + ");");
+                    if (f._IsPacked())
+                    {
+                        sb.Append(@"
+            bb.packedList = false;");
+                    }
                 }
             }
             sb.Append(@"
@@ -393,7 +410,7 @@ namespace " + c.Namespace + @"
             var typeId = kv.Value;
 
             sb.Append(@"
-            xx.Object.Register<" + ct._GetTypeDecl_Csharp() + @">(" + typeId++ + ");");
+            xx.Object.Register<" + ct._GetTypeDecl_Csharp() + @">(" + typeId++ + (ct._IsTree(asm) ? ", true" : "") + ");");
         }
 
         sb.Append(@"
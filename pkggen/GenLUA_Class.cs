@@ -120,9 +120,11 @@ public static class GenLUA_Class
         local p = getmetatable( o )
         p.__proto.FromBBuffer( bb, p )");
             }
+            if (c._Has<TemplateLibrary.Tree>()) throw new Exception("lua 暂不支持 Tree: " + c.FullName);
             var ftns = new Dictionary<string, int>();
             foreach (var f in fs)
             {
+                if (f._IsPacked()) throw new Exception("lua 暂不支持 Packed: " + c.FullName + "." + f.Name);
                 var ft = f.FieldType;
                 var ftn = ft.IsEnum ? ft.GetEnumUnderlyingType().Name : ft._IsNumeric() ? ft.Name : "Object";
                 if (ft._IsBBuffer() || ft._IsString() || ft._IsRef()) ftn = "Object";
@@ -0,0 +1,32 @@
+﻿#include "tests.h"
+
+int RunTests()
+{
+	std::pair<char const*, int(*)()> tests[] =
+	{
+		{ "CrossThreadFree", TestCrossThreadFree },
+		{ "Trim", TestTrim },
+		{ "RecycleSkipsArena", TestRecycleSkipsArena },
+		{ "BudgetHardLimit", TestBudgetHardLimit },
+		{ "BudgetNoAbort", TestBudgetNoAbort },
+		{ "PrewarmFromStats", TestPrewarmFromStats },
+		{ "HandleInvalidation", TestHandleInvalidation },
+		{ "DeferredListenerRelease", TestDeferredListenerRelease },
+		{ "RejectBadFrames", TestRejectBadFrames },
+		{ "PeerPoolPerListener", TestPeerPoolPerListener },
+		{ "SendOverBudget", TestSendOverBudget },
+		{ "PackedListRoundTrip", TestPackedListRoundTrip },
+		{ "SkipUnsupported", TestSkipUnsupported },
+		{ "DedupStringsRoundTrip", TestDedupStringsRoundTrip },
+		{ "ViewCopyOverBudget", TestViewCopyOverBudget },
+		{ "PkgToJson", TestPkgToJson },
+	};
+	int failed = 0;
+	for (auto& t : tests)
+	{
+		auto r = t.second();
+		std::cout << "test " << t.first << (r ? " failed" : " ok") << std::endl;
+		if (r) ++failed;
+	}
+	return failed;
+}
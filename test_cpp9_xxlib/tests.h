@@ -0,0 +1,26 @@
+﻿#pragma once
+#include "xx_uv.h"
+
+// 单项测试失败时 输出位置与条件, 并以行号作为返回值
+#define XX_TEST_CHECK(cond) do { if (!(cond)) { std::cout << __FILE__ << ":" << __LINE__ << " check failed: " #cond << std::endl; return __LINE__; } } while (false)
+
+// 各项测试. 成功返回 0
+int TestCrossThreadFree();
+int TestTrim();
+int TestRecycleSkipsArena();
+int TestBudgetHardLimit();
+int TestBudgetNoAbort();
+int TestPrewarmFromStats();
+int TestHandleInvalidation();
+int TestDeferredListenerRelease();
+int TestRejectBadFrames();
+int TestPeerPoolPerListener();
+int TestSendOverBudget();
+int TestPackedListRoundTrip();
+int TestSkipUnsupported();
+int TestDedupStringsRoundTrip();
+int TestViewCopyOverBudget();
+int TestPkgToJson();
+
+// 依次执行所有测试. 全部成功返回 0
+int RunTests();
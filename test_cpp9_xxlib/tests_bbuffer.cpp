@@ -0,0 +1,194 @@
+﻿#include "tests.h"
+
+// 按 pkggen 生成物的写法手写的类型: a, c 标记了 Packed, b, d 没有
+class TestPackFoo : public xx::Object
+{
+public:
+	xx::List_p<int32_t> a;
+	xx::List_p<int32_t> b;
+	xx::List_p<int32_t> c;
+	xx::List_p<int32_t> d;
+
+	TestPackFoo(xx::MemPool* const& mempool) noexcept : xx::Object(mempool) {}
+	TestPackFoo(xx::BBuffer* const& bb) : xx::Object(bb)
+	{
+		if (int r = FromBBuffer(*bb)) throw r;
+	}
+	void ToBBuffer(xx::BBuffer& bb) const noexcept override
+	{
+		bb.packedList = true;
+		bb.Write(this->a);
+		bb.packedList = false;
+		bb.Write(this->b);
+		bb.packedList = true;
+		bb.Write(this->c);
+		bb.packedList = false;
+		bb.Write(this->d);
+	}
+	int FromBBuffer(xx::BBuffer& bb) noexcept override
+	{
+		bb.readLengthLimit = 0;
+		bb.packedList = true;
+		if (int r = bb.Read(this->a)) return r;
+		bb.packedList = false;
+		bb.readLengthLimit = 0;
+		if (int r = bb.Read(this->b)) return r;
+		bb.readLengthLimit = 0;
+		bb.packedList = true;
+		if (int r = bb.Read(this->c)) return r;
+		bb.packedList = false;
+		bb.readLengthLimit = 0;
+		if (int r = bb.Read(this->d)) return r;
+		return 0;
+	}
+};
+
+namespace xx
+{
+	template<> struct TypeId<TestPackFoo> { static const uint16_t value = 1000; };
+	template<> struct TypeId<xx::List<int32_t>> { static const uint16_t value = 1001; };
+	template<> struct TypeId<xx::List<xx::String_p>> { static const uint16_t value = 1002; };
+}
+
+static bool SameList(xx::List_p<int32_t> const& x, std::initializer_list<int32_t> vs)
+{
+	if (!x || x->dataLen != vs.size()) return false;
+	size_t i = 0;
+	for (auto v : vs)
+	{
+		if (x->At(i++) != v) return false;
+	}
+	return true;
+}
+
+// Packed 成员为空 或 指向已读过的 List 时, 读取不会走到 List 的读函数, packedList 须由生成物还原, 否则会串到下一个 List 成员
+int TestPackedListRoundTrip()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool::Register<TestPackFoo, xx::Object>();
+	xx::MemPool::Register<xx::List<int32_t>, xx::Object>();
+	xx::MemPool mp;
+	xx::BBuffer bb(&mp);
+
+	// a 为空, 紧随其后的 b 不打包
+	auto o = mp.MPCreatePtr<TestPackFoo>();
+	mp.MPCreateTo(o->b);
+	o->b->Add(1, 200, 300000);
+	mp.MPCreateTo(o->d);
+	o->d->Add(4, 70000);
+	bb.WriteRoot(o);
+	xx::Ptr<TestPackFoo> o2;
+	XX_TEST_CHECK(!bb.ReadRoot(o2));
+	XX_TEST_CHECK(!o2->a && !o2->c);
+	XX_TEST_CHECK(SameList(o2->b, { 1, 200, 300000 }));
+	XX_TEST_CHECK(SameList(o2->d, { 4, 70000 }));
+	XX_TEST_CHECK(bb.offset == bb.dataLen);
+
+	// c 指向已读过的 b, 紧随其后的 d 不打包
+	mp.MPCreateTo(o->a);
+	o->a->Add(5, 6);
+	o->c = o->b;
+	bb.Clear();
+	bb.WriteRoot(o);
+	XX_TEST_CHECK(!bb.ReadRoot(o2));
+	XX_TEST_CHECK(SameList(o2->a, { 5, 6 }));
+	XX_TEST_CHECK(SameList(o2->b, { 1, 200, 300000 }));
+	XX_TEST_CHECK(o2->c == o2->b);
+	XX_TEST_CHECK(SameList(o2->d, { 4, 70000 }));
+	XX_TEST_CHECK(bb.offset == bb.dataLen);
+	return 0;
+}
+
+// 未提供 SkipBBuffer / WriteJson 的类型 跳过 / 转 json 须报错, 而不是当作空对象继续读后面的数据
+int TestSkipUnsupported()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool::Register<TestPackFoo, xx::Object>();
+	xx::MemPool::Register<xx::List<int32_t>, xx::Object>();
+	xx::MemPool mp;
+	xx::BBuffer bb(&mp);
+
+	auto o = mp.MPCreatePtr<TestPackFoo>();
+	mp.MPCreateTo(o->b);
+	o->b->Add(1, 2, 3);
+	bb.WriteRoot(o);
+
+	bb.BeginRead();
+	XX_TEST_CHECK(bb.Skip<xx::Ptr<TestPackFoo>>() != 0);
+
+	bb.offset = 0;
+	xx::String s(&mp);
+	XX_TEST_CHECK(bb.RootToJson(s) != 0);
+	return 0;
+}
+
+// dedupStrings: 同内容不同指针的串只写一次, 解包后为同一实例. 预算长度须与实际写入一致, 不开启时照旧各写各的
+int TestDedupStringsRoundTrip()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool::Register<xx::List<xx::String_p>, xx::Object>();
+	xx::MemPool mp;
+	xx::BBuffer bb(&mp);
+
+	auto names = mp.MPCreatePtr<xx::List<xx::String_p>>();
+	auto bob = mp.MPCreatePtr<xx::String>("bob");
+	names->Add(mp.MPCreatePtr<xx::String>("alice"), bob, mp.MPCreatePtr<xx::String>("alice"), xx::String_p(), bob, mp.MPCreatePtr<xx::String>("bob"));
+
+	bb.WriteRoot(names);
+	auto plainLen = bb.dataLen;
+
+	bb.Clear();
+	bb.dedupStrings = true;
+	auto calcLen = bb.CalcRootLen(names);
+	bb.WriteRoot(names);
+	XX_TEST_CHECK(bb.dataLen == calcLen);
+	XX_TEST_CHECK(bb.dataLen < plainLen);
+
+	xx::Ptr<xx::List<xx::String_p>> names2;
+	XX_TEST_CHECK(!bb.ReadRoot(names2));
+	XX_TEST_CHECK(bb.offset == bb.dataLen);
+	XX_TEST_CHECK(names2->dataLen == 6);
+	XX_TEST_CHECK(names2->At(0)->Equals("alice") && names2->At(1)->Equals("bob"));
+	XX_TEST_CHECK(names2->At(2) == names2->At(0));
+	XX_TEST_CHECK(!names2->At(3));
+	XX_TEST_CHECK(names2->At(4) == names2->At(1) && names2->At(5) == names2->At(1));
+
+	// 再写一次: strStore 须已清空, 不能引用到上一次 WriteRoot 的 offset
+	bb.Clear();
+	bb.WriteRoot(names);
+	XX_TEST_CHECK(bb.dataLen == calcLen);
+	XX_TEST_CHECK(!bb.ReadRoot(names2));
+	XX_TEST_CHECK(names2->At(2) == names2->At(0));
+
+	// 不开启时 不同指针解出不同实例
+	bb.Clear();
+	bb.dedupStrings = false;
+	bb.WriteRoot(names);
+	XX_TEST_CHECK(!bb.ReadRoot(names2));
+	XX_TEST_CHECK(names2->At(2) != names2->At(0) && names2->At(2)->Equals("alice"));
+	XX_TEST_CHECK(names2->At(4) == names2->At(1) && names2->At(5) != names2->At(1));
+	return 0;
+}
+
+// View::MakeCopy 超出内存预算时返回空( 不 abort, 不解引用空指针 )
+int TestViewCopyOverBudget()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	std::string data(256 * 1024, 'a');
+	xx::View<xx::String> v;
+	v.buf = data.data();
+	v.len = data.size();
+
+	auto s = v.MakeCopy(&mp);
+	XX_TEST_CHECK(s && v.Equals(s));
+	s.Reset();
+
+	auto baseBytes = mp.GetUsedBytes();
+	mp.hardLimit = baseBytes + 64 * 1024;
+	XX_TEST_CHECK(!v.MakeCopy(&mp));
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+	mp.hardLimit = baseBytes;
+	XX_TEST_CHECK(!v.MakeCopy(&mp));
+	return 0;
+}
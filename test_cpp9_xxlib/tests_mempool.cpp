@@ -0,0 +1,290 @@
+﻿#include "tests.h"
+
+// 非 owner 线程 Free / Release 的块 退回 owner, 由 owner 回收后复用
+int TestCrossThreadFree()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	mp.InitCrossThreadFree();
+	auto baseBytes = mp.GetUsedBytes();
+
+	constexpr int n = 1000;
+	std::vector<void*> bufs;
+	std::vector<xx::String_p> strs;
+	for (int i = 0; i < n; ++i)
+	{
+		bufs.push_back(mp.Alloc(100));
+		strs.push_back(mp.MPCreatePtr<xx::String>("abc"));
+		XX_TEST_CHECK(bufs.back() && strs.back());
+	}
+	xx::String_w weak(strs[0].pointer);
+	auto usedBytes = mp.GetUsedBytes();
+	XX_TEST_CHECK(usedBytes > baseBytes);
+
+	// 别的线程归还. 此时 owner 尚未回收, 用量不变, 但 Weak 已失效
+	std::thread t([&]
+	{
+		for (auto& p : bufs) mp.Free(p);
+		strs.clear();
+	});
+	t.join();
+	XX_TEST_CHECK(!weak);
+	XX_TEST_CHECK(mp.GetUsedBytes() == usedBytes);
+
+	// owner 回收后 用量复原, 再分配同尺寸的块 全部来自退回的块
+	mp.CollectReturns();
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+	std::sort(bufs.begin(), bufs.end());
+	for (int i = 0; i < n; ++i)
+	{
+		auto p = mp.Alloc(100);
+		XX_TEST_CHECK(std::binary_search(bufs.begin(), bufs.end(), p));
+		mp.Free(p);
+	}
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+	return 0;
+}
+
+// 完全空闲的 slab 归还物理内存, 仍在使用的 slab 不动. 归还后的 slab 可复用, 指向其中的 Weak 依旧可安全检测
+int TestTrim()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto baseResident = mp.GetResidentBytes();
+
+	constexpr int n = 100000;
+	std::vector<char*> bufs;
+	std::vector<xx::String_w> weaks;
+	for (int i = 0; i < n; ++i)
+	{
+		bufs.push_back((char*)mp.Alloc(100));
+		XX_TEST_CHECK(bufs.back());
+		memset(bufs.back(), i + 1, 100);
+		auto s = mp.MPCreatePtr<xx::String>("abc");
+		XX_TEST_CHECK(s);
+		weaks.emplace_back(s.pointer);
+	}
+	auto resident = mp.GetResidentBytes();
+	XX_TEST_CHECK(resident > baseResident);
+
+	// 留下第一块, 其余归还
+	for (int i = 1; i < n; ++i) mp.Free(bufs[i]);
+	auto trimmed = mp.Trim();
+	XX_TEST_CHECK(trimmed > 0);
+	XX_TEST_CHECK(mp.GetResidentBytes() == resident - trimmed);
+	XX_TEST_CHECK(mp.Trim() == 0);
+	for (int i = 0; i < 100; ++i) XX_TEST_CHECK(bufs[0][i] == 1);
+	for (auto& w : weaks) XX_TEST_CHECK(!w);
+
+	// 再分配: 复用已归还的 slab
+	for (int i = 1; i < n; ++i)
+	{
+		bufs[i] = (char*)mp.Alloc(100);
+		XX_TEST_CHECK(bufs[i]);
+		memset(bufs[i], i + 1, 100);
+	}
+	XX_TEST_CHECK(mp.GetResidentBytes() > resident - trimmed);
+	for (int i = 1; i < n; ++i) XX_TEST_CHECK(bufs[i][99] == (char)(i + 1));
+
+	// ShrinkTo 只归还到目标值为止, 剩余的 Trim 还能归还
+	for (int i = 1; i < n; ++i) mp.Free(bufs[i]);
+	resident = mp.GetResidentBytes();
+	auto target = baseResident + (resident - baseResident) / 2;
+	auto shrunk = mp.ShrinkTo(target);
+	XX_TEST_CHECK(shrunk > 0);
+	XX_TEST_CHECK(mp.GetResidentBytes() == resident - shrunk);
+	XX_TEST_CHECK(mp.GetResidentBytes() <= target);
+	XX_TEST_CHECK(mp.Trim() > 0);
+	mp.Free(bufs[0]);
+	return 0;
+}
+
+struct TestPoolItem : xx::Object
+{
+	TestPoolItem(xx::MemPool* const& mempool) noexcept : xx::Object(mempool) {}
+	void Reset() noexcept {}
+};
+
+// arena 中的对象 Release 时不进对象池( 否则 Rewind 后池中留下悬空指针 )
+int TestRecycleSkipsArena()
+{
+	xx::MemPool mp;
+	xx::ObjectPool<TestPoolItem> pool(&mp);
+	xx::MemArena arena;
+	{
+		xx::MemArenaScope scope(mp, arena);
+		auto o = pool.TakePtr();
+		XX_TEST_CHECK(o && xx::MemPool::IsArenaMemory(o.pointer));
+	}
+	XX_TEST_CHECK(pool.Count() == 0);
+
+	auto o = pool.TakePtr();
+	XX_TEST_CHECK(o && !xx::MemPool::IsArenaMemory(o.pointer));
+	o.Reset();
+	XX_TEST_CHECK(pool.Count() == 1);
+	return 0;
+}
+
+// 超过 hardLimit 时 Alloc / Create 返回空, TryReserve 失败且原数据不变. 用量降回后又能分配. 超过 softLimit 只触发一次 OnSoftLimit
+int TestBudgetHardLimit()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto baseBytes = mp.GetUsedBytes();
+	mp.softLimit = baseBytes + 64 * 1024;
+	mp.hardLimit = baseBytes + 1024 * 1024;
+	int softHits = 0;
+	size_t hardHits = 0, lastRefused = 0;
+	mp.OnSoftLimit = [&] { ++softHits; };
+	mp.OnHardLimit = [&](size_t siz) { ++hardHits; lastRefused = siz; };
+
+	auto bb = mp.MPCreatePtr<xx::BBuffer>();
+	for (int i = 0; i < 50000; ++i) bb->Write(i);
+	XX_TEST_CHECK(softHits == 1);
+	XX_TEST_CHECK(hardHits == 0);
+
+	auto dataLen = bb->dataLen;
+	auto bufLen = bb->bufLen;
+	XX_TEST_CHECK(bb->TryReserve(4 * 1024 * 1024) != 0);
+	XX_TEST_CHECK(hardHits == 1 && lastRefused >= 4 * 1024 * 1024);
+	XX_TEST_CHECK(bb->dataLen == dataLen && bb->bufLen == bufLen);
+	XX_TEST_CHECK(!mp.Alloc(2 * 1024 * 1024));
+	XX_TEST_CHECK(hardHits == 2);
+
+	// 原数据完好
+	int v = 0;
+	for (int i = 0; i < 50000; ++i)
+	{
+		XX_TEST_CHECK(!bb->Read(v) && v == i);
+	}
+
+	// 用量降回后 又能分配. 降回以下时有过分配, 再超过可再次触发 OnSoftLimit
+	bb.Reset();
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+	mp.Free(mp.Alloc(16));
+	auto p = mp.Alloc(128 * 1024);
+	XX_TEST_CHECK(p);
+	XX_TEST_CHECK(softHits == 2);
+	mp.Free(p);
+	return 0;
+}
+
+// 超出 hardLimit 时: 解包返回错误, BBuffer 写入不 abort 而是置 overBudget( 数据完整 ), 丢弃后内存归还
+int TestBudgetNoAbort()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	xx::BBuffer bb(&mp);
+	{
+		auto s = mp.MPCreatePtr<xx::String>();
+		s->Resize(512 * 1024);
+		memset(s->buf, 'a', s->dataLen);
+		bb.WriteRoot(s);
+	}
+	auto baseBytes = mp.GetUsedBytes();
+	mp.hardLimit = baseBytes + 64 * 1024;
+
+	xx::String_p s;
+	XX_TEST_CHECK(bb.ReadRoot(s) != 0);
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+
+	xx::BBuffer bb2(&mp);
+	bb2.WriteBuf(bb);
+	XX_TEST_CHECK(bb2.overBudget);
+	XX_TEST_CHECK(bb2.dataLen == bb.dataLen && !memcmp(bb2.buf, bb.buf, bb.dataLen));
+	XX_TEST_CHECK(mp.hardLimit == baseBytes + 64 * 1024);
+	bb2.ReleaseOverBudget();
+	XX_TEST_CHECK(!bb2.overBudget && !bb2.dataLen);
+	XX_TEST_CHECK(mp.GetUsedBytes() == baseBytes);
+
+	// 预算内照常
+	bb2.Write(1, 2, 3);
+	XX_TEST_CHECK(!bb2.overBudget);
+	return 0;
+}
+
+// 统计数据存成 json 再读回 可用于预热. 不对应任何档位的下标( 例如被改过的文件 )须拒绝, 而不是拿去算块长
+int TestPrewarmFromStats()
+{
+	xx::MemPool::RegisterInternals();
+	{
+		// 3000 字节档新建的池不会用到, 预热数量可精确判断
+		xx::MemPool mp;
+		std::vector<void*> ps;
+		for (int i = 0; i < 100; ++i) ps.push_back(mp.Alloc(3000));
+		for (auto p : ps) mp.Free(p);
+		auto json = mp.MPCreatePtr<xx::String>();
+		mp.Snapshot().ToString(*json);
+		xx::MemPoolStats s;
+		XX_TEST_CHECK(!s.FromString(json->c_str()));
+		auto idx = xx::MemPool::CalcIndex(3000 + sizeof(xx::MemHeader));
+		XX_TEST_CHECK(s.items[idx].peakLives == 100);
+
+		xx::MemPool mp2;
+		XX_TEST_CHECK(mp2.Prewarm(s) >= 100);
+		XX_TEST_CHECK(mp2.Snapshot().items[idx].caches >= 100);
+	}
+
+	xx::MemPoolStats s;
+	XX_TEST_CHECK(s.FromString("{ \"items\":[{ \"index\":0, \"peakLives\":5 }] }") != 0);
+	XX_TEST_CHECK(s.FromString("{ \"items\":[{ \"index\":1000, \"peakLives\":5 }] }") != 0);
+
+	// 直接构造的统计数据: 低于 MinIndex 及超过 largeThreshold 的档位 Prewarm 都不处理
+	xx::MemPool mp;
+	memset(&s, 0, sizeof(s));
+	for (size_t i = 0; i < xx::MemPool::MinIndex(); ++i) s.items[i].peakLives = 5;
+	s.items[s.items.size() - 1].peakLives = 5;
+	XX_TEST_CHECK(mp.Prewarm(s) == 0);
+	return 0;
+}
+
+// 句柄在对象 Release / 被对象池回收 / 被别的线程释放 后失效, 内存与槽位被复用后 旧句柄依旧无效
+int TestHandleInvalidation()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	mp.InitCrossThreadFree();
+
+	auto s = mp.MPCreatePtr<xx::String>("abc");
+	auto h = mp.MakeHandle(s);
+	XX_TEST_CHECK(h && mp.Get(h) == s.pointer);
+	XX_TEST_CHECK(mp.MakeHandle(s) == h);
+	XX_TEST_CHECK(mp.GetHandlesCount() == 1);
+
+	// Release 后失效. 同尺寸的新对象复用了内存块, 旧句柄依旧无效; 新句柄复用槽位但换了代
+	auto old = s.pointer;
+	s.Reset();
+	XX_TEST_CHECK(!mp.Get(h) && !mp.GetPtr(h));
+	XX_TEST_CHECK(mp.GetHandlesCount() == 0);
+	s = mp.MPCreatePtr<xx::String>("def");
+	XX_TEST_CHECK(s.pointer == old);
+	XX_TEST_CHECK(!mp.Get(h));
+	auto h2 = mp.MakeHandle(s);
+	XX_TEST_CHECK(h2.index == h.index && h2.generation != h.generation);
+	XX_TEST_CHECK(mp.Get(h2) == s.pointer);
+
+	// 被对象池回收 同样失效, 再次取出后需重新 MakeHandle
+	{
+		xx::ObjectPool<TestPoolItem> pool(&mp);
+		auto o = pool.TakePtr();
+		auto ho = mp.MakeHandle(o);
+		auto p = o.pointer;
+		o.Reset();
+		XX_TEST_CHECK(pool.Count() == 1 && !mp.Get(ho));
+		o = pool.TakePtr();
+		XX_TEST_CHECK(o.pointer == p && !mp.Get(ho));
+	}
+
+	// 别的线程释放: 句柄表只在 owner 线程改动. 回收前 Get 已返回空, 回收时作废句柄
+	std::thread t([s = std::move(s)]() mutable { s.Reset(); });
+	t.join();
+	XX_TEST_CHECK(!mp.Get(h2));
+	XX_TEST_CHECK(mp.GetHandlesCount() == 1);
+	mp.CollectReturns();
+	XX_TEST_CHECK(mp.GetHandlesCount() == 0);
+	s = mp.MPCreatePtr<xx::String>("ghi");
+	XX_TEST_CHECK(s.pointer == old && !mp.Get(h2));
+	auto h3 = mp.MakeHandle(s);
+	XX_TEST_CHECK(h3.index == h2.index && mp.Get(h3) == s.pointer);
+	return 0;
+}
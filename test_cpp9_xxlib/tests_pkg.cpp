@@ -0,0 +1,56 @@
+﻿#include "tests.h"
+#include "pkg/PKG_class.h"
+
+// 生成物的 WriteJson: 不创建对象 直接把序列化数据转为 json. 含 null, 需转义的串, Ref 列表, 以及 Player -> Scene -> Player 的环
+int TestPkgToJson()
+{
+	PKG::AllTypesRegister();
+	xx::MemPool mp;
+	xx::BBuffer bb(&mp);
+
+	auto scene = mp.MPCreatePtr<PKG::Scene>();
+	mp.MPCreateTo(scene->players);
+	auto p1 = mp.MPCreatePtr<PKG::Player>();
+	p1->id = 1;
+	p1->name = mp.MPCreatePtr<xx::String>("a\"b\n");
+	p1->owner = scene;
+	auto p2 = mp.MPCreatePtr<PKG::Player>();
+	p2->id = 2;
+	p2->owner = scene;
+	scene->players->Add(p1, p2);
+
+	bb.WriteRoot(p1);
+	xx::String s(&mp);
+	XX_TEST_CHECK(!bb.RootToJson(s));
+	XX_TEST_CHECK(s.Equals("{\"pkgTypeName\":\"Player\",\"pkgTypeId\":3,\"id\":1,\"name\":\"a\\\"b\\n\",\"owner\":"
+		"{\"pkgTypeName\":\"Scene\",\"pkgTypeId\":4,\"players\":[\"***** recursived *****\","
+		"{\"pkgTypeName\":\"Player\",\"pkgTypeId\":3,\"id\":2,\"name\":null,\"owner\":\"***** recursived *****\"}]}}"));
+	XX_TEST_CHECK(bb.offset == bb.dataLen);
+
+	// 截断的数据须报错
+	bb.dataLen -= 1;
+	s.Clear();
+	bb.offset = 0;
+	XX_TEST_CHECK(bb.RootToJson(s) != 0);
+
+	// 再次引用转过的对象 只写标记, 不重复展开
+	auto p3 = mp.MPCreatePtr<PKG::Player>();
+	p3->id = 3;
+	auto scene2 = mp.MPCreatePtr<PKG::Scene>();
+	mp.MPCreateTo(scene2->players);
+	scene2->players->Add(p3, p3);
+	bb.Clear();
+	bb.WriteRoot(scene2);
+	s.Clear();
+	XX_TEST_CHECK(!bb.RootToJson(s));
+	XX_TEST_CHECK(s.Equals("{\"pkgTypeName\":\"Scene\",\"pkgTypeId\":4,\"players\":["
+		"{\"pkgTypeName\":\"Player\",\"pkgTypeId\":3,\"id\":3,\"name\":null,\"owner\":null},\"***** shared *****\"]}"));
+
+	// 引用处的 typeId 与被引用对象不符须报错( 数据末尾为第二个引用: typeId 3 + offset )
+	XX_TEST_CHECK(bb.buf[bb.dataLen - 2] == 3);
+	bb.buf[bb.dataLen - 2] = 4;
+	s.Clear();
+	bb.offset = 0;
+	XX_TEST_CHECK(bb.RootToJson(s) != 0);
+	return 0;
+}
@@ -0,0 +1,230 @@
+﻿#include "tests.h"
+
+// 跑 loop 直到 cond 成立( 最多约 2 秒 ). 用一个 10ms 的 timer 保证 Once 不会一直阻塞
+template<typename Cond>
+static bool RunUntil(xx::UvLoop& loop, Cond&& cond)
+{
+	auto timer = loop.mempool->CreatePtr<xx::UvTimer>(loop, 10, 10);
+	for (int i = 0; i < 200 && !cond(); ++i)
+	{
+		loop.Run(xx::UvRunMode::Once);
+	}
+	return cond();
+}
+
+// 在 23456 起找个空闲端口监听. 返回端口, 0 表示失败
+static int Listen(xx::UvLoop& loop, xx::Ptr<xx::UvTcpListener>& listener)
+{
+	for (int p = 23456; p < 23556; ++p)
+	{
+		listener = loop.mempool->CreatePtr<xx::UvTcpListener>(loop);
+		if (!listener->Bind("127.0.0.1", p) && !listener->Listen()) return p;
+	}
+	return 0;
+}
+
+// 开启延迟析构时 Release 带着已连接 peers 的 listener: listener 与 peers 须立即析构( peer 析构时要改 listener.peers 并关闭 uv 句柄 ),
+// 普通对象照常入队. 之后客户端继续发数据 / 断开, 不应有回调落到已释放的对象上( 配合 ASan 检查 )
+int TestDeferredListenerRelease()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto loopPtr = mp.MPCreatePtr<xx::UvLoop>();			// 由 mempool 创建( 其内部会对自身建 Weak, 需要内存头 )
+	auto& loop = *loopPtr;
+	XX_TEST_CHECK(!loop.InitDeferredRelease());
+
+	xx::Ptr<xx::UvTcpListener> listener;
+	int port = Listen(loop, listener);
+	XX_TEST_CHECK(port);
+
+	// 每个 peer 挂一个普通对象, 析构时跟着入队
+	int peerDisposes = 0;
+	listener->OnAccept = [&](xx::UvTcpPeer_w peer)
+	{
+		peer->userObject = mp.MPCreatePtr<xx::String>("user");
+		peer->OnDispose = [&] { ++peerDisposes; };
+	};
+
+	constexpr int numClients = 4;
+	std::vector<xx::Ptr<xx::UvTcpClient>> clients;
+	int connected = 0, disconnected = 0;
+	for (int i = 0; i < numClients; ++i)
+	{
+		auto c = mp.CreatePtr<xx::UvTcpClient>(loop);
+		c->OnConnect = [&](int status) { if (!status) ++connected; };
+		c->OnDisconnect = [&] { ++disconnected; };
+		XX_TEST_CHECK(!c->ConnectEx("127.0.0.1", port));
+		clients.push_back(std::move(c));
+	}
+	XX_TEST_CHECK(RunUntil(loop, [&] { return connected == numClients && listener->peers.dataLen == numClients; }));
+
+	auto deferreds = mp.GetDeferredCount();
+	listener.Reset();
+	XX_TEST_CHECK(peerDisposes == numClients);
+	XX_TEST_CHECK(loop.tcpListeners.dataLen == 0);
+	XX_TEST_CHECK(mp.GetDeferredCount() == deferreds + numClients);
+
+	// 客户端照常发包, 服务端已关闭, 最终全部断开
+	for (auto& c : clients)
+	{
+		c->SendBytes("hello", 5);
+	}
+	XX_TEST_CHECK(RunUntil(loop, [&] { return disconnected == numClients && !mp.GetDeferredCount(); }));
+	clients.clear();
+	return 0;
+}
+
+// 收包校验: 本端未 EnableCompress 时的压缩包, 解压长度超限的压缩包, 数据长不为 1 的控制包 均断开
+int TestRejectBadFrames()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto loopPtr = mp.MPCreatePtr<xx::UvLoop>();
+	auto& loop = *loopPtr;
+
+	xx::Ptr<xx::UvTcpListener> listener;
+	int port = Listen(loop, listener);
+	XX_TEST_CHECK(port);
+
+	xx::UvTcpPeer_w peer;
+	int peerDisposes = 0;
+	listener->OnAccept = [&](xx::UvTcpPeer_w p)
+	{
+		peer = p;
+		p->OnDispose = [&] { ++peerDisposes; };
+	};
+
+	// 连上一个新客户端 并等到服务端 accept. 返回前一个 peer 是否已断开
+	xx::Ptr<xx::UvTcpClient> client;
+	auto reconnect = [&]
+	{
+		client = mp.CreatePtr<xx::UvTcpClient>(loop);
+		peer.Reset();
+		client->ConnectEx("127.0.0.1", port);
+		return RunUntil(loop, [&] { return client->Alive() && peer; });
+	};
+	auto send = [&](std::initializer_list<uint8_t> bytes)
+	{
+		std::vector<char> v(bytes.begin(), bytes.end());
+		client->SendBytes(v.data(), (int)v.size());
+	};
+
+	// 未声明可解压 收到( 能正常解压的 )压缩包. 客户端假装对端已声明 以便发出压缩包
+	XX_TEST_CHECK(reconnect());
+	int received = 0;
+	peer->OnReceivePackage = [&](xx::BBuffer&) { ++received; };
+	client->peerDecompressable = true;
+	client->compressThreshold = 1;
+	xx::BBuffer data(&mp);
+	for (int i = 0; i < 300; ++i) data.Write((uint8_t)'a');
+	XX_TEST_CHECK(!client->Send(data));
+	XX_TEST_CHECK(RunUntil(loop, [&] { return peerDisposes == 1; }));
+	XX_TEST_CHECK(!received);
+
+	// 数据长为 2 的控制包
+	XX_TEST_CHECK(reconnect());
+	send({ 0x03, 2, 0, 1, 1 });
+	XX_TEST_CHECK(RunUntil(loop, [&] { return peerDisposes == 2; }));
+
+	// 合法的控制包不断开
+	XX_TEST_CHECK(reconnect());
+	send({ 0x03, 1, 0, 1 });
+	XX_TEST_CHECK(RunUntil(loop, [&] { return peer->peerDecompressable; }));
+	XX_TEST_CHECK(peerDisposes == 2);
+
+	// 已声明可解压 但压缩包声明的解压长度( 0x7fffffff )超过 maxUnzipLength
+	XX_TEST_CHECK(!peer->EnableCompress());
+	send({ 0x10, 6, 0, 0xff, 0xff, 0xff, 0xff, 0x07, 0 });
+	XX_TEST_CHECK(RunUntil(loop, [&] { return peerDisposes == 3; }));
+	client.Reset();
+	return 0;
+}
+
+// 两个 listener 都开启 peerPool: 断开的 peer 须回到 accept 它的 listener 的池子, 复用时也只在该 listener 上 accept
+int TestPeerPoolPerListener()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto loopPtr = mp.MPCreatePtr<xx::UvLoop>();
+	auto& loop = *loopPtr;
+
+	xx::Ptr<xx::UvTcpListener> listeners[2];
+	int ports[2];
+	for (int i = 0; i < 2; ++i)
+	{
+		ports[i] = Listen(loop, listeners[i]);
+		XX_TEST_CHECK(ports[i]);
+		listeners[i]->peerPool.limit = 4;
+	}
+
+	// 连上 listener[i] 并等到 accept, 然后断开 等到 peer 被回收
+	auto connectAndClose = [&](int i)
+	{
+		auto c = mp.CreatePtr<xx::UvTcpClient>(loop);
+		auto peers = listeners[i]->peers.dataLen;
+		c->ConnectEx("127.0.0.1", ports[i]);
+		if (!RunUntil(loop, [&] { return c->Alive() && listeners[i]->peers.dataLen == peers + 1; })) return false;
+		c.Reset();
+		return RunUntil(loop, [&] { return listeners[i]->peers.dataLen == peers; });
+	};
+
+	XX_TEST_CHECK(connectAndClose(1));
+	XX_TEST_CHECK(listeners[0]->peerPool.Count() == 0);
+	XX_TEST_CHECK(listeners[1]->peerPool.Count() == 1);
+
+	XX_TEST_CHECK(connectAndClose(0));
+	XX_TEST_CHECK(listeners[0]->peerPool.Count() == 1);
+	XX_TEST_CHECK(listeners[1]->peerPool.Count() == 1);
+
+	// 复用池中的 peer
+	XX_TEST_CHECK(connectAndClose(1));
+	XX_TEST_CHECK(connectAndClose(0));
+	XX_TEST_CHECK(listeners[0]->peerPool.Count() == 1);
+	XX_TEST_CHECK(listeners[1]->peerPool.Count() == 1);
+
+	// 先释放 listener[1], 其缓存的 peer 随之析构. listener[0] 照常工作
+	listeners[1].Reset();
+	XX_TEST_CHECK(connectAndClose(0));
+	XX_TEST_CHECK(listeners[0]->peerPool.Count() == 1);
+	return 0;
+}
+
+// 超出 hardLimit 的 Send 失败返回( 不 abort ), 连接保持, 之后预算内的包照常收发
+int TestSendOverBudget()
+{
+	xx::MemPool::RegisterInternals();
+	xx::MemPool mp;
+	auto loopPtr = mp.MPCreatePtr<xx::UvLoop>();
+	auto& loop = *loopPtr;
+
+	xx::Ptr<xx::UvTcpListener> listener;
+	int port = Listen(loop, listener);
+	XX_TEST_CHECK(port);
+	xx::UvTcpPeer_w peer;
+	size_t receivedLen = 0;
+	listener->OnAccept = [&](xx::UvTcpPeer_w p)
+	{
+		peer = p;
+		p->OnReceivePackage = [&](xx::BBuffer& bb) { receivedLen = bb.dataLen; };
+	};
+
+	auto client = mp.CreatePtr<xx::UvTcpClient>(loop);
+	client->ConnectEx("127.0.0.1", port);
+	XX_TEST_CHECK(RunUntil(loop, [&] { return client->Alive() && peer; }));
+
+	auto big = mp.MPCreatePtr<xx::String>();
+	big->Resize(512 * 1024);
+	memset(big->buf, 'a', big->dataLen);
+	mp.hardLimit = mp.GetUsedBytes() + 64 * 1024;
+	XX_TEST_CHECK(client->Send(big) < 0);
+	XX_TEST_CHECK(!client->bbSend.overBudget && !client->bbSend.bufLen);
+	XX_TEST_CHECK(client->Alive());
+
+	// 预算内的包照常发出. 收包要为读缓冲分配内存, 故先放开预算再跑 loop
+	auto small = mp.MPCreatePtr<xx::String>("hello");
+	XX_TEST_CHECK(!client->Send(small));
+	mp.hardLimit = 0;
+	XX_TEST_CHECK(RunUntil(loop, [&] { return receivedLen > 0; }));
+	XX_TEST_CHECK(client->Alive());
+	return 0;
+}
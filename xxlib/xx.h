@@ -13,6 +13,8 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <atomic>
+#include <thread>
 
 // 当 IOS 最低版本兼容参数低于 11 时无法启用 C++17, 故启用 C++14 结合下面的各种造假来解决
 #ifdef __IPHONE_OS_VERSION_MIN_REQUIRED
@@ -59,9 +61,28 @@ namespace std
 #include <optional>
 #endif
 
+// 浮点转最短字串( 见 xx_json ). 没有时退回 snprintf
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
 #ifdef _WIN32
 #include <intrin.h>     // _BitScanReverse  64
 #include <objbase.h>
+#else
+#include <sys/mman.h>  // mmap madvise
+#endif
+
+#ifdef __BMI2__
+#include <immintrin.h>  // _pext_u64 _pdep_u64
+#endif
+
+// FlatDict 控制码按 16 字节一组比较. 没有 SSE2 时走标量 SWAR
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define XX_SSE2 1
+#include <emmintrin.h>  // _mm_cmpeq_epi8 _mm_movemask_epi8
 #endif
 
 #ifdef min
@@ -354,10 +375,14 @@ namespace xx
 #include "xx_charsutils.h"
 #include "xx_string.h"
 #include "xx_bytesutils.h"
+#include "xx_flatdict.h"
+#include "xx_lz.h"
 #include "xx_bbuffer.h"
+#include "xx_delta.h"
 #include "xx_guid.h"
 #include "xx_random.h"
 #include "xx_hashset.h"
+#include "xx_json.h"
 
 #include "xx_mempool.hpp"
 #include "xx_list.hpp"
@@ -367,7 +392,11 @@ namespace xx
 #include "xx_charsutils.hpp"
 #include "xx_string.hpp"
 #include "xx_bytesutils.hpp"
+#include "xx_flatdict.hpp"
+#include "xx_lz.hpp"
 #include "xx_bbuffer.hpp"
+#include "xx_delta.hpp"
 #include "xx_guid.hpp"
 #include "xx_random.hpp"
 #include "xx_hashset.hpp"
+#include "xx_json.hpp"
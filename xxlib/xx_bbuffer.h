@@ -6,6 +6,10 @@ namespace xx
 	// 对于这个问题, 的确可以在 c++ 解包处针对 string 特化 read 流程, 创建出多个副本. 但如果该内容被再次发送时, string 就没有合并效果了. 比较纠结
 	// 通常性的建议是, 包纯用于数据收发时, 尽量使用内容复制的方式来读取解开后的数据, 除非非常有把握.
 	// 用于数据建模时, 如果有修改字串的需求, 可以用 MPCreate 直接新建, 以免牵连修改. 新建构造复制也不会慢多少.
+	// c++ 发送方设置 dedupStrings 后 也会做同样的合并( 排行榜, 聊天记录 等重复名字多的包 ), 收方同样需注意上述问题.
+
+	template<typename T>
+	struct View;
 
 	class BBuffer : public List<char>
 	{
@@ -14,6 +18,10 @@ namespace xx
 		size_t										offset = 0;				// 读指针偏移量
 		size_t										offsetRoot = 0;			// offset值写入修正
 		size_t										readLengthLimit = 0;	// 主用于传递给容器类进行长度合法校验
+		MemArena*									arena = nullptr;		// 非空时 ReadRoot 解出的对象图将分配于此( 回卷前需 Promote 要留下的对象 )
+		bool										packedList = false;		// 主用于传递给紧接着读写的 List 选择打包编码( 生成物中标记了 Packed 的成员 )
+		bool										overBudget = false;		// 写入时扩容超出了内存预算( 见 Reserve ). 置位后由调用方丢弃数据( ReleaseOverBudget )并报错
+		bool										dedupStrings = false;	// 为 true 时 一次 WriteRoot 中内容相同的 String 只写一次, 之后的同内容串( 不同指针 )写 offset 引用. 解包将得到同一实例
 
 		BBuffer(BBuffer const& o) = delete;
 		BBuffer& operator=(BBuffer const& o) = delete;
@@ -48,12 +56,67 @@ namespace xx
 		template<typename T>
 		int ReadRoot(T& v) noexcept;
 
+		// 格式: typeId + offset + [内容]( 首次出现才有 ). 树形类型( MemPool::trees ) 为 typeId + 内容
 		template<typename T>
 		void WritePtr(T* const& v) noexcept;
 
+		// 供 WritePtr, CalcPtrLen: dedupStrings 时 查找同内容 String 首次写入的 offset. 找到则替换 ptrStore 中 v 的 offset 并返回 true
+		bool DedupString(void* const& v, size_t const& idx) noexcept;
+
 		template<typename T>
 		int ReadPtr(T*& v) noexcept;
 
+		// 读写 String / BBuffer 的视图. 格式同 WritePtr, 只是每次都写入内容( 不参与 ptrStore 合并 )
+		template<typename T>
+		void WriteView(View<T> const& v) noexcept;
+
+		template<typename T>
+		int ReadView(View<T>& v) noexcept;
+
+
+		/*************************************************************************/
+		//  跳过 / 按需解码( 网关等只需包中个别成员时 免去构造整个对象图 )
+		/*************************************************************************/
+
+		// 跳过 TS 类型的数据. 指针按 typeId 查 MemPool::skippers 跳过( 不创建对象 )
+		template<typename ...TS>
+		int Skip() noexcept;
+
+		int SkipPtr() noexcept;
+
+		// 代替 ReadRoot: 将根对象的序列化数据直接以 json 追加到 s( 不创建对象. 见 xx_json.h ). 成环处写 "***** recursived *****", 再次引用处写 "***** shared *****"
+		int RootToJson(String& s) noexcept;
+
+		// 读一个指针 以 json 追加到 s. 借 idxStore 记录转过的对象: 再次引用时写 "***** shared *****", 引用转换中的( 成环 )写 "***** recursived *****"
+		int PtrToJson(String& s) noexcept;
+
+		// 代替 ReadRoot: 读出根对象的 typeId 并令 offset 指向其数据起始处. 之后可用生成物的 Read_成员名 函数只解某个成员
+		// 被跳过的部分中首次出现的对象 若被后面的指针引用到, ReadPtr 会回到该处补建
+		int ReadRootHeader(uint16_t& typeId) noexcept;
+
+
+		/*************************************************************************/
+		//  写入长度预算( 与上面的 Write 系列一一对应, 结果精确. 仅 CustomWrite 的部分无法计入 )
+		/*************************************************************************/
+
+		// 累加 vs 写入后的字节数. len 为距 WriteRoot 起点的长度( 指针偏移量的变长写入长度与之有关 )
+		template<typename ...TS>
+		void CalcLen(size_t& len, TS const& ...vs) noexcept;
+
+		template<typename T>
+		void CalcPtrLen(T* const& v, size_t& len) noexcept;
+
+		template<typename T>
+		void CalcViewLen(View<T> const& v, size_t& len) noexcept;
+
+		// 返回 WriteRoot(v) 将写入的字节数( 会用到并清空 ptrStore )
+		template<typename T>
+		size_t CalcRootLen(T const& v) noexcept;
+
+		// 先算出长度一次性 Reserve 再 WriteRoot. 适合较大的包, 免去写入过程中的多次扩容
+		template<typename T>
+		void WriteRootReserved(T const& v) noexcept;
+
 
 		/*************************************************************************/
 		//  其他工具函数
@@ -61,6 +124,12 @@ namespace xx
 
 		void Clear() noexcept;
 
+		// 写入前的扩容( 覆盖 List::Reserve ). 超出内存预算时不 abort: 临时放行 hardLimit 完成扩容( 紧随其后的写入不会越界 ), 并置 overBudget
+		void Reserve(size_t const& capacity) noexcept;
+
+		// 丢弃超出预算写入的数据 并归还内存, 清除 overBudget
+		void ReleaseOverBudget() noexcept;
+
 		// 根据数据类型往当前位置写入默认值
 		template<typename T>
 		void WriteDefaultValue() noexcept;
@@ -99,11 +168,40 @@ namespace xx
 		BBuffer(BBuffer* const& bb);
 		void ToBBuffer(BBuffer& bb) const noexcept override;
 		int FromBBuffer(BBuffer& bb) noexcept override;
+		void CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept override;
+
+		// 读出内容 以 json 数组( 各字节 0 ~ 255 )追加到 s
+		static int WriteJson(BBuffer& bb, String& s) noexcept;
 
 		void ToString(String& s) const noexcept override;
 	};
 
 
+	// 指向 bb 中 String / BBuffer 内容的只读视图. 读的时候不创建对象, 不复制内容. 序列化格式与 Ptr<String> / Ptr<BBuffer> 相同
+	// 仅在 bb 内容不变期间有效( 例如收包回调之内 ). 要留存则 MakeCopy
+	template<typename T>
+	struct View
+	{
+		static_assert(std::is_same_v<T, String> || std::is_same_v<T, BBuffer>);
+
+		char const* buf = nullptr;		// 为空表示 nil
+		size_t len = 0;
+
+		explicit operator bool() const noexcept;
+
+		bool Equals(char const* const& s, size_t const& sLen) const noexcept;
+		template<size_t sLen>
+		bool Equals(char const(&s)[sLen]) const noexcept;
+		bool Equals(Ptr<T> const& o) const noexcept;
+
+		// 复制内容到新建的 T. nil 或 超出内存预算 时返回空
+		Ptr<T> MakeCopy(MemPool* const& mempool) const noexcept;
+	};
+
+	using StrView = View<String>;
+	using BufView = View<BBuffer>;
+
+
 	using BBuffer_p = Ptr<BBuffer>;
 
 	using BBuffer_r = Ref<BBuffer>;
@@ -47,13 +47,16 @@ namespace xx
 	inline void BBuffer::BeginWrite() noexcept
 	{
 		mempool->ptrStore->Clear();
+		if (dedupStrings) mempool->strStore->Clear();
 		offsetRoot = dataLen;
+		packedList = false;
 	}
 
 	inline void BBuffer::BeginRead() noexcept
 	{
 		mempool->idxStore->Clear();
 		offsetRoot = offset;
+		packedList = false;
 	}
 
 	template<typename T>
@@ -67,7 +70,14 @@ namespace xx
 	int BBuffer::ReadRoot(T& v) noexcept
 	{
 		BeginRead();
-		return Read(v);
+		if (!arena) return Read(v);
+
+		// 解包期间令 mempool 从 arena 分配
+		auto bak = mempool->arena;
+		mempool->arena = arena;
+		auto r = Read(v);
+		mempool->arena = bak;
+		return r;
 	}
 
 	template<typename T>
@@ -81,7 +91,18 @@ namespace xx
 		assert(v->memHeader().typeId);	// forget Register TypeId ? 
 		Write(v->memHeader().typeId);
 
+		// 树形类型: 不会被共享, 直接写内容
+		if (MemPool::trees[v->memHeader().typeId])
+		{
+			v->ToBBuffer(*this);
+			return;
+		}
+
 		auto rtv = mempool->ptrStore->Add((void*)v, dataLen - offsetRoot);
+		if (rtv.success && dedupStrings && v->memHeader().typeId == TypeId_v<String> && DedupString((void*)v, rtv.index))
+		{
+			rtv.success = false;
+		}
 		Write(mempool->ptrStore->ValueAt(rtv.index));
 		if (rtv.success)
 		{
@@ -89,6 +110,15 @@ namespace xx
 		}
 	}
 
+	inline bool BBuffer::DedupString(void* const& v, size_t const& idx) noexcept
+	{
+		auto& offset = mempool->ptrStore->ValueAt(idx);
+		auto rtv = mempool->strStore->Add((String*)v, offset);
+		if (rtv.success) return false;
+		offset = mempool->strStore->ValueAt(rtv.index);
+		return true;
+	}
+
 	template<typename T>
 	int BBuffer::ReadPtr(T*& v) noexcept
 	{
@@ -106,6 +136,14 @@ namespace xx
 		// simple validate tid( bad data or forget register typeid ? )
 		if (!MemPool::creators[tid]) return -5;
 
+		// 树形类型: 无 offset, 直接建( 不进 idxStore )
+		if (MemPool::trees[tid])
+		{
+			if (!mempool->IsBaseOf(TypeId<T>::value, tid)) return -2;
+			v = (T*)MemPool::creators[tid](mempool, this, 0);
+			return v ? 0 : -3;
+		}
+
 		// get offset
 		size_t ptr_offset = 0, bb_offset_bak = offset - offsetRoot;
 		if (auto rtv = Read(ptr_offset)) return rtv;
@@ -127,7 +165,24 @@ namespace xx
 		{
 			// try get ptr from dict
 			std::pair<void*, uint16_t> val;
-			if (!mempool->idxStore->TryGetValue(ptr_offset, val)) return -4;
+			if (!mempool->idxStore->TryGetValue(ptr_offset, val))
+			{
+				// 首次出现时被 ReadView 读走 或 被跳过了( 没建对象 ). 回到该处补建
+				if (ptr_offset > bb_offset_bak) return -4;
+				if (!mempool->IsBaseOf(TypeId<T>::value, tid)) return -2;
+				auto bak = offset;
+				offset = offsetRoot + ptr_offset;
+				size_t o = 0;
+				if (Read(o) || o != ptr_offset)
+				{
+					offset = bak;
+					return -4;
+				}
+				val.first = MemPool::creators[tid](mempool, this, ptr_offset);
+				val.second = tid;
+				offset = bak;
+				if (val.first == nullptr) return -3;
+			}
 
 			// inherit validate
 			if (!mempool->IsBaseOf(TypeId<T>::value, val.second)) return -2;
@@ -139,6 +194,225 @@ namespace xx
 	}
 
 
+	template<typename T>
+	void BBuffer::WriteView(View<T> const& v) noexcept
+	{
+		if (!v.buf)
+		{
+			Write((uint8_t)0);
+			return;
+		}
+		Write(TypeId_v<T>);
+		Write(dataLen - offsetRoot);		// 同 ptrStore 首次放入时的值
+		Write(v.len);
+		WriteBuf(v.buf, v.len);				// v 不可指向自身( Reserve 可能令其失效 )
+	}
+
+	template<typename T>
+	int BBuffer::ReadView(View<T>& v) noexcept
+	{
+		uint16_t tid;
+		if (auto rtv = Read(tid)) return rtv;
+		if (tid == 0)
+		{
+			v.buf = nullptr;
+			v.len = 0;
+			return 0;
+		}
+		if (tid != TypeId_v<T>) return -2;
+
+		size_t ptr_offset = 0, bb_offset_bak = offset - offsetRoot;
+		if (auto rtv = Read(ptr_offset)) return rtv;
+
+		// 引用前面出现过的: 回到该处 跳过偏移量 再读 长度 + 内容
+		auto bak = offset;
+		if (ptr_offset != bb_offset_bak)
+		{
+			if (ptr_offset > bb_offset_bak) return -4;
+			offset = offsetRoot + ptr_offset;
+			size_t o = 0;
+			if (Read(o) || o != ptr_offset)
+			{
+				offset = bak;
+				return -4;
+			}
+		}
+
+		size_t len = 0;
+		int rtv = Read(len);
+		if (!rtv)
+		{
+			if (readLengthLimit != 0 && len > readLengthLimit) rtv = -1;
+			else if (len > dataLen - offset) rtv = -2;
+		}
+		if (!rtv)
+		{
+			v.buf = buf + offset;
+			v.len = len;
+			offset += len;
+		}
+		if (ptr_offset != bb_offset_bak)
+		{
+			offset = bak;
+		}
+		return rtv;
+	}
+
+
+	/*************************************************************************/
+	//  跳过 / 按需解码
+	/*************************************************************************/
+
+	template<typename ...TS>
+	int BBuffer::Skip() noexcept
+	{
+		int r = 0;
+		std::initializer_list<int> n{ (r ? 0 : (r = BytesFunc<TS>::Skip(*this), 0))... };
+		return r;
+	}
+
+	inline int BBuffer::SkipPtr() noexcept
+	{
+		uint16_t tid;
+		if (auto rtv = Read(tid)) return rtv;
+		if (tid == 0) return 0;
+		if (!MemPool::skippers[tid]) return -5;
+		if (MemPool::trees[tid]) return MemPool::skippers[tid](*this);
+
+		size_t ptr_offset = 0, bb_offset_bak = offset - offsetRoot;
+		if (auto rtv = Read(ptr_offset)) return rtv;
+
+		// 首次出现才有内容
+		if (ptr_offset == bb_offset_bak) return MemPool::skippers[tid](*this);
+		return ptr_offset > bb_offset_bak ? -4 : 0;
+	}
+
+	inline int BBuffer::RootToJson(String& s) noexcept
+	{
+		BeginRead();
+		return PtrToJson(s);
+	}
+
+	inline int BBuffer::PtrToJson(String& s) noexcept
+	{
+		uint16_t tid;
+		if (auto rtv = Read(tid)) return rtv;
+		if (tid == 0)
+		{
+			s.Append("null");
+			return 0;
+		}
+		auto& f = MemPool::jsoners[tid];
+		if (!f) return -5;
+		if (MemPool::trees[tid]) return f(*this, s);
+
+		size_t ptr_offset = 0, bb_offset_bak = offset - offsetRoot;
+		if (auto rtv = Read(ptr_offset)) return rtv;
+
+		// 引用前面出现过的: 须是转过的同类型对象. 仍在转换中即为成环, 否则只写个标记( 不再转一遍, 以免共享引用令输出成倍膨胀 )
+		if (ptr_offset != bb_offset_bak)
+		{
+			std::pair<void*, uint16_t> val;
+			if (ptr_offset > bb_offset_bak || !mempool->idxStore->TryGetValue(ptr_offset, val) || val.second != tid) return -4;
+			s.Append(val.first ? "\"***** recursived *****\"" : "\"***** shared *****\"");
+			return 0;
+		}
+
+		// idxStore 记录转过的对象( first 非空表示转换中 )
+		auto idx = mempool->idxStore->Add(ptr_offset, std::make_pair((void*)this, tid)).index;
+		auto rtv = f(*this, s);
+		mempool->idxStore->ValueAt(idx).first = nullptr;
+		return rtv;
+	}
+
+	inline int BBuffer::ReadRootHeader(uint16_t& typeId) noexcept
+	{
+		BeginRead();
+		if (auto rtv = Read(typeId)) return rtv;
+		if (typeId == 0) return 0;
+		if (!MemPool::creators[typeId]) return -5;
+		if (MemPool::trees[typeId]) return 0;
+
+		size_t ptr_offset = 0, bb_offset_bak = offset - offsetRoot;
+		if (auto rtv = Read(ptr_offset)) return rtv;
+		if (ptr_offset != bb_offset_bak) return -4;
+		return 0;
+	}
+
+
+	/*************************************************************************/
+	//  写入长度预算
+	/*************************************************************************/
+
+	template<typename ...TS>
+	void BBuffer::CalcLen(size_t& len, TS const& ...vs) noexcept
+	{
+		std::initializer_list<int> n{ (BytesFunc<TS>::CalcLen(*this, vs, len), 0)... };
+	}
+
+	// 同 WritePtr 的流程, 只是用 len 代替 dataLen - offsetRoot
+	template<typename T>
+	void BBuffer::CalcPtrLen(T* const& v, size_t& len) noexcept
+	{
+		if (!v)
+		{
+			len += 1;
+			return;
+		}
+		len += VarLen7(v->memHeader().typeId);
+
+		if (MemPool::trees[v->memHeader().typeId])
+		{
+			v->CalcBBufferLen(*this, len);
+			return;
+		}
+
+		auto rtv = mempool->ptrStore->Add((void*)v, len);
+		if (rtv.success && dedupStrings && v->memHeader().typeId == TypeId_v<String> && DedupString((void*)v, rtv.index))
+		{
+			rtv.success = false;
+		}
+		len += VarLen7(mempool->ptrStore->ValueAt(rtv.index));
+		if (rtv.success)
+		{
+			v->CalcBBufferLen(*this, len);
+		}
+	}
+
+	template<typename T>
+	void BBuffer::CalcViewLen(View<T> const& v, size_t& len) noexcept
+	{
+		if (!v.buf)
+		{
+			len += 1;
+			return;
+		}
+		len += VarLen7(TypeId_v<T>);
+		len += VarLen7(len);
+		len += VarLen7(v.len) + v.len;
+	}
+
+	template<typename T>
+	size_t BBuffer::CalcRootLen(T const& v) noexcept
+	{
+		mempool->ptrStore->Clear();
+		if (dedupStrings) mempool->strStore->Clear();
+		packedList = false;
+		size_t len = 0;
+		CalcLen(len, v);
+		mempool->ptrStore->Clear();
+		if (dedupStrings) mempool->strStore->Clear();
+		return len;
+	}
+
+	template<typename T>
+	void BBuffer::WriteRootReserved(T const& v) noexcept
+	{
+		this->Reserve(this->dataLen + CalcRootLen(v));
+		WriteRoot(v);
+	}
+
+
 	/*************************************************************************/
 	//  其他工具函数
 	/*************************************************************************/
@@ -149,6 +423,24 @@ namespace xx
 		offset = 0;
 	}
 
+	inline void BBuffer::Reserve(size_t const& capacity) noexcept
+	{
+		if (capacity <= bufLen) return;
+		if (!TryReserve(capacity)) return;
+		overBudget = true;
+		auto bak = mempool->hardLimit;
+		mempool->hardLimit = 0;
+		BaseType::Reserve(capacity);								// 系统内存不足时仍会 abort
+		mempool->hardLimit = bak;
+	}
+
+	inline void BBuffer::ReleaseOverBudget() noexcept
+	{
+		BaseType::Clear(true);
+		offset = 0;
+		overBudget = false;
+	}
+
 	// 根据数据类型往当前位置写入默认值
 	template<typename T>
 	void BBuffer::WriteDefaultValue() noexcept
@@ -243,6 +535,7 @@ namespace xx
 		if (auto rtv = bb.Read(len)) return rtv;
 		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
 		if (bb.offset + len > bb.dataLen) return -2;
+		if (this->TryReserve(len)) return -3;						// 超出内存预算
 		this->Resize(len);
 		if (len == 0) return 0;
 		memcpy(this->buf, bb.buf + bb.offset, len);
@@ -250,6 +543,29 @@ namespace xx
 		return 0;
 	}
 
+	inline void BBuffer::CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept
+	{
+		len += VarLen7(dataLen) + dataLen;
+	}
+
+	inline int BBuffer::WriteJson(BBuffer& bb, String& s) noexcept
+	{
+		size_t len = 0;
+		if (auto rtv = bb.Read(len)) return rtv;
+		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+		if (bb.offset + len > bb.dataLen) return -2;
+		s.Reserve(s.dataLen + len * 4 + 2);
+		s.buf[s.dataLen++] = '[';
+		for (size_t i = 0; i < len; ++i)
+		{
+			if (i) s.buf[s.dataLen++] = ',';
+			s.dataLen += u32toa_branchlut((uint8_t)bb.buf[bb.offset + i], s.buf + s.dataLen);
+		}
+		s.buf[s.dataLen++] = ']';
+		bb.offset += len;
+		return 0;
+	}
+
 	inline void BBuffer::ToString(String &s) const noexcept
 	{
 		s.Append("{ \"len\":", dataLen, ", \"offset\":", offset, ", \"data\":[ ");
@@ -260,4 +576,82 @@ namespace xx
 		if (dataLen) s.dataLen -= 2;
 		s.Append(" ] }");
 	}
+
+
+
+	/*************************************************************************/
+	//  View
+	/*************************************************************************/
+
+	template<typename T>
+	inline View<T>::operator bool() const noexcept
+	{
+		return buf != nullptr;
+	}
+
+	template<typename T>
+	inline bool View<T>::Equals(char const* const& s, size_t const& sLen) const noexcept
+	{
+		if (!buf || !s || len != sLen) return false;
+		return memcmp(buf, s, len) == 0;
+	}
+
+	template<typename T>
+	template<size_t sLen>
+	inline bool View<T>::Equals(char const(&s)[sLen]) const noexcept
+	{
+		return Equals(s, sLen - 1);
+	}
+
+	template<typename T>
+	inline bool View<T>::Equals(Ptr<T> const& o) const noexcept
+	{
+		if (!buf && !o) return true;
+		if (!buf || !o) return false;
+		return Equals(o->buf, o->dataLen);
+	}
+
+	template<typename T>
+	inline Ptr<T> View<T>::MakeCopy(MemPool* const& mempool) const noexcept
+	{
+		if (!buf) return Ptr<T>();
+		auto p = mempool->MPCreatePtr<T>();
+		if (!p || p->TryReserve(len)) return Ptr<T>();				// 超出内存预算
+		p->AddRange(buf, len);
+		return p;
+	}
+
+	template<typename T>
+	struct BytesFunc<View<T>, void>
+	{
+		static inline void WriteTo(BBuffer& bb, View<T> const& in) noexcept
+		{
+			bb.WriteView(in);
+		}
+		static inline int ReadFrom(BBuffer& bb, View<T>& out) noexcept
+		{
+			return bb.ReadView(out);
+		}
+		static inline void CalcLen(BBuffer& bb, View<T> const& in, size_t& len) noexcept
+		{
+			bb.CalcViewLen(in, len);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			View<T> tmp;
+			return bb.ReadView(tmp);
+		}
+	};
+
+	// String 视图输出内容, BBuffer 视图输出长度
+	template<typename T>
+	struct StrFunc<View<T>, void>
+	{
+		static inline void WriteTo(String& s, View<T> const& in) noexcept
+		{
+			if (!in) s.Append("nil");
+			else if constexpr (std::is_same_v<T, String>) s.AddRange(in.buf, in.len);
+			else s.Append("{ \"len\":", in.len, " }");
+		}
+	};
 }
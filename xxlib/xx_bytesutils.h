@@ -19,10 +19,33 @@ namespace xx
 	size_t VarWrite7(char* const& dstBuf, uint32_t in) noexcept;
 	size_t VarWrite7(char* const& dstBuf, uint64_t in) noexcept;
 
+	// 剩余数据不少于 8 字节时 一次读入 8 字节, 据各字节最高位一次算出长度并拼接( 同 float 直接 memcpy, 假定小尾机器 )
 	int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint32_t& out) noexcept;
 	int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint16_t& out) noexcept;
 	int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint64_t& out) noexcept;
 
+	// 结果与 VarWrite7 相同, 但无论长短都是一次写入 8 字节( uint64 超过 56 位时再写 1 字节 ). dstBuf 需留有至少 8 / 9 字节空间
+	size_t VarWrite7Fast(char* const& dstBuf, uint16_t in) noexcept;
+	size_t VarWrite7Fast(char* const& dstBuf, uint32_t in) noexcept;
+	size_t VarWrite7Fast(char* const& dstBuf, uint64_t in) noexcept;
+
+	// 将 8 字节中每字节的低 7 位 紧凑拼接成 56 位整数 / 反向展开. 有 BMI2 时用 pext / pdep
+	uint64_t VarPack7(uint64_t x) noexcept;
+	uint64_t VarUnpack7(uint64_t x) noexcept;
+
+	// 计算 7 位一组 的组数, 展开并加上延续位( 供 VarWrite7Fast 使用 )
+	uint64_t VarSpread7(uint64_t const& in, size_t& len) noexcept;
+
+	// 读入 8 字节. 返回各字节中 不带延续位 的最高位 组成的掩码( 供 VarRead7 使用 )
+	uint64_t VarLoad7(char const* const& p, uint64_t& v) noexcept;
+
+	// 返回 非 0 整数 低位 / 高位 连续 0 的个数
+	size_t Ctz64(uint64_t const& x) noexcept;
+	size_t Clz64(uint64_t const& x) noexcept;
+
+	// 返回 VarWrite7 写入 in 所需字节数( 0 算 1 字节 )
+	size_t VarLen7(uint64_t const& in) noexcept;
+
 
 	/**************************************************************************************************/
 	// 类型--操作适配模板区
@@ -43,6 +66,17 @@ namespace xx
 			assert(false);
 			return 0;
 		}
+		// 累加 WriteTo 将写入的字节数( 指针偏移量与 bb.dataLen 有关, 故 len 需从 WriteRoot 起点算起 )
+		static void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			assert(false);
+		}
+		// 跳过一个 T 的序列化数据( 尽量不创建对象 ). 返回非 0 表示数据有误
+		static int Skip(BBuffer& bb) noexcept
+		{
+			assert(false);
+			return 0;
+		}
 	};
 
 }
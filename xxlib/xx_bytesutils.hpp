@@ -27,6 +27,118 @@ namespace xx
 		return (int64_t)(in >> 1) ^ (-(int64_t)(in & 1));
 	}
 
+	inline size_t Ctz64(uint64_t const& x) noexcept
+	{
+		assert(x);
+#ifdef _MSC_VER
+		unsigned long r = 0;
+#if defined(_WIN64) || defined(_M_X64)
+		_BitScanForward64(&r, x);
+#else
+		if (!_BitScanForward(&r, (uint32_t)x))
+		{
+			_BitScanForward(&r, (uint32_t)(x >> 32));
+			r += 32;
+		}
+#endif
+		return (size_t)r;
+#else
+		return (size_t)__builtin_ctzll(x);
+#endif
+	}
+
+	inline size_t Clz64(uint64_t const& x) noexcept
+	{
+		assert(x);
+#ifdef _MSC_VER
+		unsigned long r = 0;
+#if defined(_WIN64) || defined(_M_X64)
+		_BitScanReverse64(&r, x);
+#else
+		if (_BitScanReverse(&r, (uint32_t)(x >> 32))) r += 32;
+		else _BitScanReverse(&r, (uint32_t)x);
+#endif
+		return (size_t)(63 - r);
+#else
+		return (size_t)__builtin_clzll(x);
+#endif
+	}
+
+	inline uint64_t VarPack7(uint64_t x) noexcept
+	{
+#ifdef __BMI2__
+		return _pext_u64(x, 0x7F7F7F7F7F7F7F7Full);
+#else
+		// 7 -> 14 -> 28 -> 56 位 逐级合并相邻两段
+		x &= 0x7F7F7F7F7F7F7F7Full;
+		x = (x & 0x007F007F007F007Full) | ((x & 0x7F007F007F007F00ull) >> 1);
+		x = (x & 0x00003FFF00003FFFull) | ((x & 0x3FFF00003FFF0000ull) >> 2);
+		x = (x & 0x000000000FFFFFFFull) | ((x & 0x0FFFFFFF00000000ull) >> 4);
+		return x;
+#endif
+	}
+
+	inline uint64_t VarUnpack7(uint64_t x) noexcept
+	{
+#ifdef __BMI2__
+		return _pdep_u64(x, 0x7F7F7F7F7F7F7F7Full);
+#else
+		// VarPack7 的逆过程. 只用到低 56 位
+		x = (x & 0x000000000FFFFFFFull) | ((x & 0x00FFFFFFF0000000ull) << 4);
+		x = (x & 0x00003FFF00003FFFull) | ((x & 0x0FFFC0000FFFC000ull) << 2);
+		x = (x & 0x007F007F007F007Full) | ((x & 0x3F803F803F803F80ull) << 1);
+		return x;
+#endif
+	}
+
+	// 计算 7 位一组 的组数( 8 字节内. in 为 0 也算 1 组 ), 展开并给前 组数 - 1 个字节 加上延续位
+	inline uint64_t VarSpread7(uint64_t const& in, size_t& len) noexcept
+	{
+		auto bits = 64 - Clz64(in | 1);
+		len = (bits + 6) / 7;
+		auto x = VarUnpack7(in);
+		if (len > 8) return x | 0x8080808080808080ull;
+		return x | (0x8080808080808080ull & ((uint64_t(1) << ((len - 1) * 8)) - 1));
+	}
+
+	inline size_t VarLen7(uint64_t const& in) noexcept
+	{
+		return (64 - Clz64(in | 1) + 6) / 7;
+	}
+
+	inline size_t VarWrite7Fast(char* const& dstBuf, uint16_t in) noexcept
+	{
+		size_t len;
+		auto x = VarSpread7(in, len);
+		memcpy(dstBuf, &x, 8);
+		return len;
+	}
+
+	inline size_t VarWrite7Fast(char* const& dstBuf, uint32_t in) noexcept
+	{
+		size_t len;
+		auto x = VarSpread7(in, len);
+		memcpy(dstBuf, &x, 8);
+		return len;
+	}
+
+	inline size_t VarWrite7Fast(char* const& dstBuf, uint64_t in) noexcept
+	{
+		size_t len;
+		auto x = VarSpread7(in, len);
+		memcpy(dstBuf, &x, 8);
+		if (len <= 8) return len;
+		dstBuf[8] = (char)(in >> 56);				// 第 9 字节 存满 8 位
+		return 9;
+	}
+
+	// 读入 8 字节. 返回 不带延续位 的字节 的最高位掩码( 最低的那个即为终止字节. 0 表示 8 字节都带延续位 )
+	inline uint64_t VarLoad7(char const* const& p, uint64_t& v) noexcept
+	{
+		memcpy(&v, p, 8);
+		return ~v & 0x8080808080808080ull;
+	}
+
 	inline size_t VarWrite7(char* const&dstBuf, uint16_t in) noexcept
 	{
 		uint32_t len = 0;
@@ -44,6 +156,17 @@ namespace xx
 	inline int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint16_t& out) noexcept
 	{
 		if (offset >= dataLen) return -1;// NotEnoughData;
+		if (dataLen - offset >= 8)
+		{
+			uint64_t v;
+			auto stops = VarLoad7(srcBuf + offset, v);
+			if (!(stops & 0x808080ull)) return -2;// Overflow;
+			auto x = VarPack7(v & (((stops & (0 - stops)) << 1) - 1));
+			if (x >> 16) return -2;// Overflow;
+			out = (uint16_t)x;
+			offset += (Ctz64(stops) + 1) >> 3;
+			return 0;
+		}
 		auto p = srcBuf + offset;
 		uint32_t i = 0, b7;
 		int32_t lshift = 0;
@@ -89,6 +212,17 @@ namespace xx
 	inline int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint32_t& out) noexcept
 	{
 		if (offset >= dataLen) return -1;// NotEnoughData;
+		if (dataLen - offset >= 8)
+		{
+			uint64_t v;
+			auto stops = VarLoad7(srcBuf + offset, v);
+			if (!(stops & 0x8080808080ull)) return -2;// Overflow;
+			auto x = VarPack7(v & (((stops & (0 - stops)) << 1) - 1));
+			if (x >> 32) return -2;// Overflow;
+			out = (uint32_t)x;
+			offset += (Ctz64(stops) + 1) >> 3;
+			return 0;
+		}
 		auto p = srcBuf + offset;
 		uint32_t i = 0, b7;
 		int32_t lshift = 0;
@@ -141,6 +275,22 @@ namespace xx
 	inline int VarRead7(char const* const& srcBuf, size_t dataLen, size_t& offset, uint64_t& out) noexcept
 	{
 		if (offset >= dataLen) return -1;// NotEnoughData;
+		if (dataLen - offset >= 8)
+		{
+			uint64_t v;
+			auto stops = VarLoad7(srcBuf + offset, v);
+			if (stops)
+			{
+				out = VarPack7(v & (((stops & (0 - stops)) << 1) - 1));
+				offset += (Ctz64(stops) + 1) >> 3;
+				return 0;
+			}
+			// 前 8 字节都带延续位: 第 9 字节存满 8 位
+			if (dataLen - offset < 9) return -1;// NotEnoughData;
+			out = VarPack7(v) | ((uint64_t)(uint8_t)srcBuf[offset + 8] << 56);
+			offset += 9;
+			return 0;
+		}
 		auto p = srcBuf + offset;
 		uint64_t i = 0, b7;
 		int32_t lshift = 0;
@@ -191,6 +341,16 @@ namespace xx
 			bb.offset += sizeof(T);
 			return 0;
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			len += sizeof(T);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			if (bb.offset + sizeof(T) > bb.dataLen) return -1;
+			bb.offset += sizeof(T);
+			return 0;
+		}
 	};
 
 	// 适配 2+ 字节无符号整数( 变长读写 )
@@ -199,11 +359,11 @@ namespace xx
 	{
 		static inline void WriteTo(BBuffer& bb, T const &in) noexcept
 		{
-			bb.Reserve(bb.dataLen + sizeof(T) + 1);
+			bb.Reserve(bb.dataLen + 9);		// VarWrite7Fast 需留足空间
 			//bb.dataLen += VarWrite7(bb.buf + bb.dataLen, in);   // ios compile error
-			if constexpr (sizeof(T) == 2) bb.dataLen += VarWrite7(bb.buf + bb.dataLen, *(uint16_t const*)&in);
-			if constexpr (sizeof(T) == 4) bb.dataLen += VarWrite7(bb.buf + bb.dataLen, *(uint32_t const*)&in);
-			if constexpr (sizeof(T) == 8) bb.dataLen += VarWrite7(bb.buf + bb.dataLen, *(uint64_t const*)&in);
+			if constexpr (sizeof(T) == 2) bb.dataLen += VarWrite7Fast(bb.buf + bb.dataLen, *(uint16_t const*)&in);
+			if constexpr (sizeof(T) == 4) bb.dataLen += VarWrite7Fast(bb.buf + bb.dataLen, *(uint32_t const*)&in);
+			if constexpr (sizeof(T) == 8) bb.dataLen += VarWrite7Fast(bb.buf + bb.dataLen, *(uint64_t const*)&in);
 		}
 		static inline int ReadFrom(BBuffer& bb, T &out) noexcept
 		{
@@ -212,6 +372,15 @@ namespace xx
 			if constexpr (sizeof(T) == 4) return VarRead7(bb.buf, bb.dataLen, bb.offset, *(uint32_t*)&out);
 			if constexpr (sizeof(T) == 8) return VarRead7(bb.buf, bb.dataLen, bb.offset, *(uint64_t*)&out);
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			len += VarLen7((uint64_t)in);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			T tmp;
+			return ReadFrom(bb, tmp);
+		}
 	};
 
 	// 适配 2+ 字节有符号整数( ZigZag 变长读写 )
@@ -220,8 +389,8 @@ namespace xx
 	{
 		static inline void WriteTo(BBuffer& bb, T const &in) noexcept
 		{
-			bb.Reserve(bb.dataLen + sizeof(T) + 1);
-			bb.dataLen += VarWrite7(bb.buf + bb.dataLen, ZigZagEncode(in));
+			bb.Reserve(bb.dataLen + 9);		// VarWrite7Fast 需留足空间
+			bb.dataLen += VarWrite7Fast(bb.buf + bb.dataLen, ZigZagEncode(in));
 		}
 		static inline int ReadFrom(BBuffer& bb, T &out) noexcept
 		{
@@ -230,6 +399,15 @@ namespace xx
 			out = ZigZagDecode(i);
 			return rtv;
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			len += VarLen7((uint64_t)ZigZagEncode(in));
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			T tmp;
+			return ReadFrom(bb, tmp);
+		}
 	};
 
 	// 适配 enum( 根据原始数据类型调上面的适配 )
@@ -245,6 +423,14 @@ namespace xx
 		{
 			return BytesFunc<UT>::ReadFrom(bb, (UT&)out);
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			BytesFunc<UT>::CalcLen(bb, (UT const&)in, len);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return BytesFunc<UT>::Skip(bb);
+		}
 	};
 
 	// 适配 double
@@ -321,6 +507,28 @@ namespace xx
 				return -2;								// failed
 			}
 		}
+		static inline void CalcLen(BBuffer& bb, double const &in, size_t& len) noexcept
+		{
+			if (in == 0 || std::isnan(in) || std::isinf(in))
+			{
+				len += 1;
+				return;
+			}
+			auto i = (int32_t)in;
+			if (in == (double)i)
+			{
+				len += 1 + VarLen7(ZigZagEncode(i));
+			}
+			else
+			{
+				len += 1 + sizeof(double);
+			}
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			double tmp;
+			return ReadFrom(bb, tmp);
+		}
 	};
 
 	// 适配 literal string ( 只是为方便测试. 转为 String 写入 长度 + 内容 )
@@ -338,6 +546,15 @@ namespace xx
 			assert(false);
 			return 0;
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& totalLen) noexcept
+		{
+			totalLen += VarLen7(len - 1) + len - 1;
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			assert(false);
+			return 0;
+		}
 	};
 
 	// 适配 Object
@@ -357,6 +574,14 @@ namespace xx
 		{
 			return out.FromBBuffer(bb);
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			in.CalcBBufferLen(bb, len);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return T::SkipBBuffer(bb);
+		}
 	};
 
 	// 适配 Ptr<T>
@@ -375,6 +600,14 @@ namespace xx
 			out = t;
 			return rtv;
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			bb.CalcPtrLen(in.pointer, len);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return bb.SkipPtr();
+		}
 	};
 
 	// 适配 Ref<T>
@@ -394,6 +627,15 @@ namespace xx
 			out = t;
 			return rtv;
 		}
+		static inline void CalcLen(BBuffer& bb, T const &in, size_t& len) noexcept
+		{
+			if (in) bb.CalcPtrLen(in.pointer, len);
+			else len += 1;
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			return bb.SkipPtr();
+		}
 	};
 
 
@@ -433,5 +675,17 @@ namespace xx
 			}
 			return 0;
 		}
+		static inline void CalcLen(BBuffer& bb, std::optional<T> const &in, size_t& len) noexcept
+		{
+			len += 1;
+			if (in) BytesFunc<T>::CalcLen(bb, *in, len);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			uint8_t hasValue = 0;
+			if (auto r = bb.Read(hasValue)) return r;
+			if (!hasValue) return 0;
+			return BytesFunc<T>::Skip(bb);
+		}
 	};
 }
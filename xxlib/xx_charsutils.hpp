@@ -585,6 +585,76 @@ namespace xx
 		}
 	};
 
+	// 适配 MemPoolStats
+	template<>
+	struct StrFunc<MemPoolStats, void>
+	{
+		static inline void WriteTo(String& s, MemPoolStats const& in) noexcept
+		{
+			in.ToString(s);
+		}
+	};
+
+	inline void MemPoolStats::ToString(String& s) const noexcept
+	{
+		s.Append("{ \"liveBytes\":", liveBytes, ", \"peakBytes\":", peakBytes, ", \"residentBytes\":", residentBytes
+			, ", \"largeAllocs\":", largeAllocs, ", \"largeLives\":", largeLives, ", \"largeBytes\":", largeBytes, ", \"items\":[");
+		bool first = true;
+		for (size_t i = 0; i < items.size(); ++i)
+		{
+			auto& o = items[i];
+			if (!o.allocs && !o.caches) continue;
+			if (first) first = false;
+			else s.Append(", ");
+			s.Append("{ \"index\":", i, ", \"size\":", MemPool::IndexToSize(i)
+				, ", \"allocs\":", o.allocs, ", \"hits\":", o.hits, ", \"misses\":", o.misses
+				, ", \"lives\":", o.lives, ", \"caches\":", o.caches, ", \"peakLives\":", o.peakLives, " }");
+		}
+		s.Append("] }");
+	}
+
+	inline int MemPoolStats::FromString(char const* const& in) noexcept
+	{
+		memset(this, 0, sizeof(*this));
+
+		// 读 key 后面的数字. 找不到 或 越过 end 就不填
+		auto readNum = [](char const* p, char const* const& end, char const* const& key, auto& out) noexcept
+		{
+			p = strstr(p, key);
+			if (!p || (end && p >= end)) return;
+			out = 0;
+			for (p += strlen(key); *p >= '0' && *p <= '9'; ++p) out = out * 10 + (*p - '0');
+		};
+
+		auto p = strstr(in, "\"items\":[");
+		if (!p) return -1;
+		readNum(in, p, "\"liveBytes\":", liveBytes);
+		readNum(in, p, "\"peakBytes\":", peakBytes);
+		readNum(in, p, "\"residentBytes\":", residentBytes);
+		readNum(in, p, "\"largeAllocs\":", largeAllocs);
+		readNum(in, p, "\"largeLives\":", largeLives);
+		readNum(in, p, "\"largeBytes\":", largeBytes);
+
+		// 逐个读出 { "index":i, ... }
+		while ((p = strstr(p, "\"index\":")))
+		{
+			size_t idx = -1;
+			readNum(p, nullptr, "\"index\":", idx);
+			if (idx < MemPool::MinIndex() || idx >= items.size()) return -2;		// 不对应任何档位的下标( 文件损坏或被改 )
+			auto end = strchr(p, '}');
+			if (!end) return -3;
+			auto& o = items[idx];
+			readNum(p, end, "\"allocs\":", o.allocs);
+			readNum(p, end, "\"hits\":", o.hits);
+			readNum(p, end, "\"misses\":", o.misses);
+			readNum(p, end, "\"lives\":", o.lives);
+			readNum(p, end, "\"caches\":", o.caches);
+			readNum(p, end, "\"peakLives\":", o.peakLives);
+			p = end;
+		}
+		return 0;
+	}
+
 	// 适配 std::pair<char*, char*>
 	template<>
 	struct StrFunc<std::pair<char*, char*>, void>
@@ -0,0 +1,60 @@
+﻿#pragma once
+namespace xx
+{
+	/**************************************************************************************************/
+	// 差量快照编解码: 以对端已确认的 基准 为参照, 只写有变化的成员
+	// 格式: 成员变化掩码( 定长 (成员数 + 7) / 8 字节, 先占位后回填 ) + 各变化成员的差量
+	// 整数写 ZigZag 变长差值, 浮点可按 精度 q 量化为定点整数后同样写差值( q 为 0 则写原始字节 ), bool 变化即取反, 不写内容
+	// 双方基准须一致: 发送方用 上次被确认时发出的对象, 接收方用 上次被确认时还原出的对象
+	/**************************************************************************************************/
+
+	class BBuffer;
+
+	// 基础适配模板
+	template<typename T, typename ENABLE = void>
+	struct DeltaFunc
+	{
+		static_assert(!std::is_same_v<ENABLE, ENABLE>, "DeltaFunc 未适配该类型");
+
+		// 有变化时写入 v 相对 base 的差量 并返回 true. 无变化返回 false 且不写
+		static bool WriteTo(BBuffer& bb, T const& base, T const& v, double const& q) noexcept;
+
+		// 读出差量 以 base 为基准 还原到 out( 可以就是 base ). 指针类型总是新建对象, 不改 base 所指
+		static int ReadFrom(BBuffer& bb, T const& base, T& out, double const& q) noexcept;
+	};
+
+
+	// 供生成物按成员顺序写差量( 构造时为 n 个成员的掩码占位, 各 Write 有变化时置位 )
+	struct DeltaWriter
+	{
+		BBuffer& bb;
+		size_t maskOffset;
+		size_t idx = 0;
+		size_t count = 0;		// 有变化的成员数
+
+		DeltaWriter(BBuffer& bb, size_t const& n) noexcept;
+		DeltaWriter(DeltaWriter const&) = delete;
+		DeltaWriter& operator=(DeltaWriter const&) = delete;
+
+		template<typename T>
+		void Write(T const& base, T const& v, double const& q = 0) noexcept;
+	};
+
+	// 供生成物按成员顺序读差量( 未变化的成员从 base 复制 )
+	struct DeltaReader
+	{
+		BBuffer& bb;
+		size_t maskOffset = 0;
+		size_t idx = 0;
+
+		DeltaReader(BBuffer& bb) noexcept;
+		DeltaReader(DeltaReader const&) = delete;
+		DeltaReader& operator=(DeltaReader const&) = delete;
+
+		// 读 n 个成员的掩码
+		int Begin(size_t const& n) noexcept;
+
+		template<typename T>
+		int Read(T const& base, T& out, double const& q = 0) noexcept;
+	};
+}
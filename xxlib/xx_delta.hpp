@@ -0,0 +1,292 @@
+﻿#pragma once
+namespace xx
+{
+	inline DeltaWriter::DeltaWriter(BBuffer& bb, size_t const& n) noexcept
+		: bb(bb)
+		, maskOffset(bb.dataLen)
+	{
+		auto len = (n + 7) / 8;
+		bb.Reserve(bb.dataLen + len);
+		memset(bb.buf + bb.dataLen, 0, len);
+		bb.dataLen += len;
+	}
+
+	template<typename T>
+	inline void DeltaWriter::Write(T const& base, T const& v, double const& q) noexcept
+	{
+		if (DeltaFunc<T>::WriteTo(bb, base, v, q))
+		{
+			bb.buf[maskOffset + idx / 8] |= (char)(1 << (idx & 7));
+			++count;
+		}
+		++idx;
+	}
+
+
+	inline DeltaReader::DeltaReader(BBuffer& bb) noexcept
+		: bb(bb)
+	{
+	}
+
+	inline int DeltaReader::Begin(size_t const& n) noexcept
+	{
+		auto len = (n + 7) / 8;
+		if (len > bb.dataLen - bb.offset) return -1;
+		maskOffset = bb.offset;
+		bb.offset += len;
+		idx = 0;
+		return 0;
+	}
+
+	template<typename T>
+	inline int DeltaReader::Read(T const& base, T& out, double const& q) noexcept
+	{
+		auto i = idx++;
+		if (bb.buf[maskOffset + i / 8] & (1 << (i & 7)))
+		{
+			return DeltaFunc<T>::ReadFrom(bb, base, out, q);
+		}
+		if (&out != &base)
+		{
+			out = base;
+		}
+		return 0;
+	}
+
+
+	/**************************************************************************************************/
+	// 类型适配
+	/**************************************************************************************************/
+
+	// 适配 整数( ZigZag 差值. 1 字节的类型直接写 1 字节差值 )
+	template<typename T>
+	struct DeltaFunc<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+	{
+		typedef std::make_signed_t<T> ST;
+		static inline bool WriteTo(BBuffer& bb, T const& base, T const& v, double const& q) noexcept
+		{
+			if (v == base) return false;
+			bb.Write((ST)(T)(v - base));
+			return true;
+		}
+		static inline int ReadFrom(BBuffer& bb, T const& base, T& out, double const& q) noexcept
+		{
+			ST d = 0;
+			if (auto r = bb.Read(d)) return r;
+			out = (T)(base + (T)d);
+			return 0;
+		}
+	};
+
+	// 适配 bool( 有变化即取反, 不写内容 )
+	template<>
+	struct DeltaFunc<bool, void>
+	{
+		static inline bool WriteTo(BBuffer& bb, bool const& base, bool const& v, double const& q) noexcept
+		{
+			return v != base;
+		}
+		static inline int ReadFrom(BBuffer& bb, bool const& base, bool& out, double const& q) noexcept
+		{
+			out = !base;
+			return 0;
+		}
+	};
+
+	// 适配 enum( 根据原始数据类型调上面的适配 )
+	template<typename T>
+	struct DeltaFunc<T, std::enable_if_t<std::is_enum_v<T>>>
+	{
+		typedef std::underlying_type_t<T> UT;
+		static inline bool WriteTo(BBuffer& bb, T const& base, T const& v, double const& q) noexcept
+		{
+			return DeltaFunc<UT>::WriteTo(bb, (UT const&)base, (UT const&)v, q);
+		}
+		static inline int ReadFrom(BBuffer& bb, T const& base, T& out, double const& q) noexcept
+		{
+			return DeltaFunc<UT>::ReadFrom(bb, (UT const&)base, (UT&)out, q);
+		}
+	};
+
+	// 适配 float, double. q > 0 时 按 q 量化为定点整数写 ZigZag 差值( 数值需在 q * 2^63 以内, 不可为 nan / inf ). 否则 按位比较, 有变化写原始字节
+	template<typename T>
+	struct DeltaFunc<T, std::enable_if_t<std::is_floating_point_v<T>>>
+	{
+		static inline int64_t Quantize(T const& v, double const& q) noexcept
+		{
+			auto d = (double)v / q;
+			return (int64_t)(d < 0 ? d - 0.5 : d + 0.5);		// 四舍五入( 比 llround 快 )
+		}
+		static inline bool WriteTo(BBuffer& bb, T const& base, T const& v, double const& q) noexcept
+		{
+			if (q > 0)
+			{
+				auto a = Quantize(base, q);
+				auto b = Quantize(v, q);
+				if (a == b) return false;
+				bb.Write((int64_t)(b - a));
+				return true;
+			}
+			if (!memcmp(&base, &v, sizeof(T))) return false;
+			bb.WriteBuf((char const*)&v, sizeof(T));
+			return true;
+		}
+		static inline int ReadFrom(BBuffer& bb, T const& base, T& out, double const& q) noexcept
+		{
+			if (q > 0)
+			{
+				int64_t d = 0;
+				if (auto r = bb.Read(d)) return r;
+				out = (T)((double)(Quantize(base, q) + d) * q);
+				return 0;
+			}
+			if (bb.offset + sizeof(T) > bb.dataLen) return -1;
+			memcpy(&out, bb.buf + bb.offset, sizeof(T));
+			bb.offset += sizeof(T);
+			return 0;
+		}
+	};
+
+	// 适配 std::optional<T>. 标志位 0: 无值, 1: 有值 后跟相对 基准值 的差量( base 无值时以 T() 为基准 ), 2: 有值 等于 T()
+	template<typename T>
+	struct DeltaFunc<std::optional<T>, void>
+	{
+		static inline bool WriteTo(BBuffer& bb, std::optional<T> const& base, std::optional<T> const& v, double const& q) noexcept
+		{
+			if (!v)
+			{
+				if (!base) return false;
+				bb.Write((uint8_t)0);
+				return true;
+			}
+			auto bak = bb.dataLen;
+			bb.Write((uint8_t)1);
+			if (DeltaFunc<T>::WriteTo(bb, base ? *base : T(), *v, q)) return true;
+			if (base)
+			{
+				bb.dataLen = bak;
+				return false;
+			}
+			bb.buf[bak] = 2;
+			return true;
+		}
+		static inline int ReadFrom(BBuffer& bb, std::optional<T> const& base, std::optional<T>& out, double const& q) noexcept
+		{
+			uint8_t flag = 0;
+			if (auto r = bb.Read(flag)) return r;
+			if (flag == 1)
+			{
+				T v;
+				if (auto r = DeltaFunc<T>::ReadFrom(bb, base ? *base : T(), v, q)) return r;
+				out.emplace(std::move(v));
+			}
+			else if (flag == 2)
+			{
+				out.emplace();
+			}
+			else if (flag == 0)
+			{
+#ifdef __IPHONE_OS_VERSION_MIN_REQUIRED
+				out = std::experimental::nullopt;
+#else
+				out.reset();
+#endif
+			}
+			else return -2;
+			return 0;
+		}
+	};
+
+	// 适配 Ptr<String>. 内容有变化时写 长度 + 1( 0 表示 nil ) + 内容
+	template<>
+	struct DeltaFunc<Ptr<String>, void>
+	{
+		static inline bool WriteTo(BBuffer& bb, Ptr<String> const& base, Ptr<String> const& v, double const& q) noexcept
+		{
+			if (!v)
+			{
+				if (!base) return false;
+				bb.Write((uint8_t)0);
+				return true;
+			}
+			if (base && base->dataLen == v->dataLen && !memcmp(base->buf, v->buf, v->dataLen)) return false;
+			bb.Write(v->dataLen + 1);
+			bb.WriteBuf(v->buf, v->dataLen);
+			return true;
+		}
+		static inline int ReadFrom(BBuffer& bb, Ptr<String> const& base, Ptr<String>& out, double const& q) noexcept
+		{
+			size_t len = 0;
+			if (auto r = bb.Read(len)) return r;
+			if (!len)
+			{
+				out.Reset();
+				return 0;
+			}
+			--len;
+			if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+			if (len > bb.dataLen - bb.offset) return -2;
+			out = bb.mempool->MPCreatePtr<String>(bb.buf + bb.offset, len);
+			if (!out) return -3;
+			bb.offset += len;
+			return 0;
+		}
+	};
+
+	// 适配 Ptr<List<T>>. 有变化时写 长度 + 1( 0 表示 nil ) + 元素变化掩码 + 各变化元素相对 base 同下标元素( 超出则为 T() ) 的差量
+	template<typename T>
+	struct DeltaFunc<Ptr<List<T>>, void>
+	{
+		static inline bool WriteTo(BBuffer& bb, Ptr<List<T>> const& base, Ptr<List<T>> const& v, double const& q) noexcept
+		{
+			if (!v)
+			{
+				if (!base) return false;
+				bb.Write((uint8_t)0);
+				return true;
+			}
+			auto bak = bb.dataLen;
+			auto baseLen = base ? base->dataLen : 0;
+			bb.Write(v->dataLen + 1);
+			DeltaWriter dw(bb, v->dataLen);
+			T zero{};
+			for (size_t i = 0; i < v->dataLen; ++i)
+			{
+				dw.Write(i < baseLen ? base->buf[i] : zero, v->buf[i], q);
+			}
+			if (base && baseLen == v->dataLen && !dw.count)
+			{
+				bb.dataLen = bak;
+				return false;
+			}
+			return true;
+		}
+		static inline int ReadFrom(BBuffer& bb, Ptr<List<T>> const& base, Ptr<List<T>>& out, double const& q) noexcept
+		{
+			size_t len = 0;
+			if (auto r = bb.Read(len)) return r;
+			if (!len)
+			{
+				out.Reset();
+				return 0;
+			}
+			--len;
+			if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+			if ((len + 7) / 8 > bb.dataLen - bb.offset) return -2;		// 每个元素至少占 1 位掩码
+
+			auto list = bb.mempool->MPCreatePtr<List<T>>(len);
+			if (!list || list->TryReserve(len)) return -3;			// 超出内存预算
+			list->Resize(len);
+			auto baseLen = base ? base->dataLen : 0;
+			DeltaReader dr(bb);
+			if (auto r = dr.Begin(len)) return r;
+			T zero{};
+			for (size_t i = 0; i < len; ++i)
+			{
+				if (auto r = dr.Read(i < baseLen ? base->buf[i] : zero, list->buf[i], q)) return r;
+			}
+			out = std::move(list);
+			return 0;
+		}
+	};
+}
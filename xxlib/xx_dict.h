@@ -38,6 +38,12 @@ namespace xx
 		int                *buckets;                // 桶数组
 		Node               *nodes;                  // 节点数组
 		Data               *items;                  // 数据数组( 与节点数组同步下标 )
+
+		int                 incrementalThreshold;   // 扩容时数据量 >= 此值则走增量迁移. 0: 关闭
+		int                 oldBucketsLen;          // 增量迁移中: 旧桶数组长
+		int                *oldBuckets;             // 增量迁移中: 旧桶数组( 尚未迁走的链仍挂在这里 ). 迁完即释放并置空
+		int                 rehashIndex;            // 增量迁移中: 下一个待迁移的旧桶下标
+		static constexpr int rehashStepBuckets = 4; // 每次 Add / Remove 顺带迁移的旧桶数( 保证下次扩容前迁完 )
 	public:
 
 		explicit Dict(MemPool* const& mempool, int const& capacity = 16);
@@ -49,6 +55,11 @@ namespace xx
 		// 只支持没数据时扩容或空间用尽扩容( 如果不这样限制, 扩容时的 遍历损耗 略大 )
 		void Reserve(int capacity = 0) noexcept;
 
+		// 开启增量扩容: 扩容时若数据量 >= threshold, 不再一次性重建所有链, 而是保留旧桶数组,
+		// 之后每次 Add / Remove 顺带迁移几个旧桶, 以限制单次插入的最坏耗时. 用于 百万级 且 跑在事件循环里 的场合
+		// 注意: 扩容时 节点 / 数据数组 的搬迁( 顺序复制 ) 仍是一次完成, 摊掉的是随机访存的重建链表部分
+		void EnableIncrementalRehash(int const& threshold = 65536) noexcept;
+
 		// 根据 key 返回下标. -1 表示没找到.
 		int Find(TK const& key) const noexcept;
 
@@ -136,6 +147,12 @@ namespace xx
 	protected:
 		// 用于 析构, Clear
 		void DeleteKVs() noexcept;
+
+		// 增量迁移: 将旧桶 oldBucket 上的整条链挂到新桶数组
+		void MigrateBucket(uint32_t const& oldBucket) noexcept;
+
+		// 增量迁移: 按顺序迁移 n 个旧桶. 全部迁完则释放旧桶数组
+		void RehashStep(int n) noexcept;
 	};
 
 
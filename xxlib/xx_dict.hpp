@@ -13,6 +13,10 @@ namespace xx
 		memset(buckets, -1, bucketsLen * sizeof(int));  // -1 代表 "空"
 		nodes = (Node*)mempool->Alloc(bucketsLen * sizeof(Node));
 		items = (Data*)mempool->Alloc(bucketsLen * sizeof(Data));
+		incrementalThreshold = 0;
+		oldBucketsLen = 0;
+		oldBuckets = nullptr;
+		rehashIndex = 0;
 	}
 
 	template <typename TK, typename TV>
@@ -22,6 +26,54 @@ namespace xx
 		mempool->Free(buckets);
 		mempool->Free(nodes);
 		mempool->Free(items);
+		if (oldBuckets)
+		{
+			mempool->Free(oldBuckets);
+		}
+	}
+
+	template <typename TK, typename TV>
+	void Dict<TK, TV>::EnableIncrementalRehash(int const& threshold) noexcept
+	{
+		assert(threshold > 0);
+		incrementalThreshold = threshold;
+	}
+
+	template <typename TK, typename TV>
+	void Dict<TK, TV>::MigrateBucket(uint32_t const& oldBucket) noexcept
+	{
+		assert(oldBuckets);
+		for (int i = oldBuckets[oldBucket]; i >= 0;)
+		{
+			auto next = nodes[i].next;
+			auto index = nodes[i].hashCode % bucketsLen;
+			if (buckets[index] >= 0)
+			{
+				items[buckets[index]].prev = i;
+			}
+			items[i].prev = -1;
+			nodes[i].next = buckets[index];
+			buckets[index] = i;
+			i = next;
+		}
+		oldBuckets[oldBucket] = -1;                 // 已迁走. 之后 Find 扫到的是空链
+	}
+
+	template <typename TK, typename TV>
+	void Dict<TK, TV>::RehashStep(int n) noexcept
+	{
+		assert(oldBuckets);
+		for (; n > 0 && rehashIndex < oldBucketsLen; --n)
+		{
+			MigrateBucket(rehashIndex++);
+		}
+		if (rehashIndex == oldBucketsLen)
+		{
+			mempool->Free(oldBuckets);
+			oldBuckets = nullptr;
+			oldBucketsLen = 0;
+			rehashIndex = 0;
+		}
 	}
 
 	template <typename TK, typename TV>
@@ -32,6 +84,11 @@ namespace xx
 
 		// hash 按桶数取模 定位到具体 链表, 扫找
 		auto hashCode = HashFunc<TK>::GetHashCode(k);
+		if (oldBuckets)                             // 增量迁移中: 先把 key 所在旧链迁过来, 再顺带推进几个
+		{
+			MigrateBucket(hashCode % (uint32_t)oldBucketsLen);
+			RehashStep(rehashStepBuckets);
+		}
 		auto targetBucket = hashCode % bucketsLen;
 		for (int i = buckets[targetBucket]; i >= 0; i = nodes[i].next)
 		{
@@ -91,16 +148,32 @@ namespace xx
 		assert(buckets);
 		assert(count == 0 || count == bucketsLen);          // 确保扩容函数使用情型
 
+		// 上一轮增量迁移还没完成( 手动 Reserve 或 大量 Find 少量 Add ), 先迁完
+		if (oldBuckets)
+		{
+			RehashStep(oldBucketsLen);
+		}
+
 		// 得到空间利用率最高的扩容长度并直接修改 bucketsLen( count 为当前数据长 )
 		if (capacity == 0)
 		{
 			capacity = count * 2;                           // 2倍扩容
 		}
 		if (capacity <= bucketsLen) return;
+		auto prevBucketsLen = bucketsLen;
 		bucketsLen = (int)GetPrime(capacity, sizeof(Data));
 
-		// 桶扩容并全部初始化( 后面会重新映射一次 )
-		mempool->Free(buckets);
+		// 桶扩容并全部初始化( 后面会重新映射一次 ). 增量模式下旧桶保留, 链表原样挂着慢慢迁
+		if (incrementalThreshold && count >= incrementalThreshold)
+		{
+			oldBuckets = buckets;
+			oldBucketsLen = prevBucketsLen;
+			rehashIndex = 0;
+		}
+		else
+		{
+			mempool->Free(buckets);
+		}
 		buckets = (int*)mempool->Alloc(bucketsLen * sizeof(int));
 		memset(buckets, -1, bucketsLen * sizeof(int));
 
@@ -121,10 +194,12 @@ namespace xx
 				items[i].key.TK::~TK();
 				new (&newItems[i].value) TV((TV&&)items[i].value);
 				items[i].value.TV::~TV();
+				newItems[i].prev = items[i].prev;           // 增量模式下旧链还要用
 			}
 			mempool->Free(items);
 			items = newItems;
 		}
+		if (oldBuckets) return;
 
 		// 遍历所有节点, 重构桶及链表( 扩容情况下没有节点空洞 )
 		for (int i = 0; i < count; i++)
@@ -152,6 +227,16 @@ namespace xx
 				return i;
 			}
 		}
+		if (oldBuckets)                             // 增量迁移中: 还没迁走的旧链也要找( 已迁的旧桶为 -1 )
+		{
+			for (int i = oldBuckets[hashCode % (uint32_t)oldBucketsLen]; i >= 0; i = nodes[i].next)
+			{
+				if (nodes[i].hashCode == hashCode && EqualsFunc<TK>::EqualsTo(items[i].key, k))
+				{
+					return i;
+				}
+			}
+		}
 		return -1;
 	}
 
@@ -160,6 +245,10 @@ namespace xx
 	{
 		assert(buckets);
 		assert(idx >= 0 && idx < count && items[idx].prev != -2);
+		if (oldBuckets)                 // 增量迁移中: 确保节点已挂在新桶上, 以下逻辑照旧
+		{
+			MigrateBucket(nodes[idx].hashCode % (uint32_t)oldBucketsLen);
+		}
 		if (items[idx].prev < 0)
 		{
 			buckets[nodes[idx].hashCode % bucketsLen] = nodes[idx].next;
@@ -180,6 +269,11 @@ namespace xx
 		items[idx].key.~TK();
 		items[idx].value.~TV();
 		items[idx].prev = -2;           // foreach 时的无效标志
+
+		if (oldBuckets)
+		{
+			RehashStep(rehashStepBuckets);
+		}
 	}
 
 	// 可传入一个资源回收函数来搞事
@@ -192,6 +286,13 @@ namespace xx
 		}
 
 		assert(buckets);
+		if (oldBuckets)
+		{
+			mempool->Free(oldBuckets);
+			oldBuckets = nullptr;
+			oldBucketsLen = 0;
+			rehashIndex = 0;
+		}
 		if (!count) return;
 		DeleteKVs();
 		memset(buckets, -1, bucketsLen * sizeof(int));
@@ -338,6 +439,13 @@ namespace xx
 			return true;
 		}
 
+		// 增量迁移中: 新旧 key 所在旧链都先迁过来, 以下逻辑照旧
+		if (oldBuckets)
+		{
+			MigrateBucket(node.hashCode % (uint32_t)oldBucketsLen);
+			MigrateBucket(newHashCode % (uint32_t)oldBucketsLen);
+		}
+
 		// 位于相同 bucket, 直接改 has & key 并退出函数
 		auto targetBucket = node.hashCode % (uint32_t)bucketsLen;
 		auto newTargetBucket = newHashCode % (uint32_t)bucketsLen;
@@ -0,0 +1,158 @@
+﻿#pragma once
+namespace xx
+{
+	// Swiss table 风格的开放寻址字典. 与 Dict 接口基本一致( Find / Add / Remove / ValueAt / for 遍历 )
+	// 每个格子配 1 字节控制码: 最高位为 1 表示 空 或 删除, 否则低 7 位存 hash 片段( h2 )
+	// 格子按 16 个一组, 查找时一次比较一组控制码( SSE2 或 标量 ), 命中 h2 才去比 key
+	// 容量为 2^N, 用乘法散列( 取高位 )定位组, 不取模. 负载上限 7/8
+	// 注意: 与 Dict 不同, 扩容( Add / Reserve ) 后下标会变化, 不可跨 Add 持有下标
+
+	template <typename TK, typename TV>
+	class FlatDict : public Object
+	{
+	public:
+		typedef TK KeyType;
+		typedef TV ValueType;
+
+		struct Data
+		{
+			TK              key;
+			TV              value;
+		};
+
+		static constexpr int groupWidth = 16;           // 每组格子数
+		static constexpr int8_t ctrlEmpty = -128;       // 0x80: 空
+		static constexpr int8_t ctrlDeleted = -2;       // 0xFE: 已删除( 墓碑 )
+
+	//private:
+		int                 count;                  // 已使用格子数
+		int                 capacity;               // 格子总数( 2^N, 最少 16 )
+		int                 growthLeft;             // 还能放多少个才触发扩容( 墓碑也占名额 )
+		int                 groupShift;             // 32 - log2(组数). 定位组: (h >> 32) >> groupShift
+		int8_t             *ctrls;                  // 控制码数组
+		Data               *items;                  // 数据数组( 与控制码数组同步下标 )
+	public:
+
+		explicit FlatDict(MemPool* const& mempool, int const& capacity = 16);
+		~FlatDict();
+		FlatDict(FlatDict const& o) = delete;
+		FlatDict& operator=(FlatDict const& o) = delete;
+
+
+		// 确保至少能放下 capacity 个数据而不扩容
+		void Reserve(int capacity = 0) noexcept;
+
+		// 根据 key 返回下标. -1 表示没找到.
+		int Find(TK const& key) const noexcept;
+
+		// 根据 key 移除一条数据
+		void Remove(TK const& key) noexcept;
+
+		// 根据 下标 移除一条数据( unsafe )
+		void RemoveAt(int const& idx) noexcept;
+
+		// 规则同 std. 如果 key 不存在, 将创建 key, TV默认值 的元素出来
+		template<typename K>
+		TV& operator[](K&& key) noexcept;
+
+		// 可传入一个资源回收函数来搞事
+		void Clear(std::function<void(Data&)> killer = nullptr) noexcept;
+
+		// 放入数据. 如果放入失败, 将返回 false 以及已存在的数据的下标
+		template<typename K, typename V>
+		DictAddResult Add(K&& k, V&& v, bool const& override = false) noexcept;
+
+		// 取数据记录数
+		uint32_t Count() const noexcept;
+
+		// 是否没有数据
+		bool Empty() noexcept;
+
+		// 试着填充数据到 outV. 如果不存在, 就返回 false
+		bool TryGetValue(TK const& key, TV& outV) noexcept;
+
+		// 同 operator[]
+		template<typename K>
+		TV& At(K&& key) noexcept;
+
+
+		// 下标直读系列( unsafe )
+
+		// 读下标所在 key
+		TK const& KeyAt(int const& idx) const noexcept;
+
+		// 读下标所在 value
+		TV& ValueAt(int const& idx) noexcept;
+		TV const& ValueAt(int const& idx) const noexcept;
+
+		// 简单 check 某下标是否有效.
+		bool IndexExists(int const& idx) const noexcept;
+
+
+		// for( auto &c :  支持
+		struct Iter
+		{
+			FlatDict& hs;
+			int i;
+			bool operator!=(Iter const& other) noexcept { return i != other.i; }
+			Iter& operator++() noexcept
+			{
+				while (++i < hs.capacity)
+				{
+					if (hs.ctrls[i] >= 0) break;
+				}
+				return *this;
+			}
+			Data& operator*() { return hs.items[i]; }
+		};
+		Iter begin() noexcept
+		{
+			if (Empty()) return end();
+			for (int i = 0; i < capacity; ++i)
+			{
+				if (ctrls[i] >= 0) return Iter{ *this, i };
+			}
+			return end();
+		}
+		Iter end() noexcept { return Iter{ *this, capacity }; }
+
+	protected:
+		// 将 hashCode 乘法打散为 64 位. 高位作组定位, bit 25 ~ 31 作 h2
+		static uint64_t MixHash(uint32_t const& hashCode) noexcept;
+
+		// 返回一组控制码中 等于 h 的位图( 第 n 位对应组内第 n 格. 标量版可能误报, 需再比对 )
+		static uint32_t GroupMatch(int8_t const* const& g, int8_t const& h) noexcept;
+
+		// 返回一组控制码中 空 的位图( 精确 )
+		static uint32_t GroupMatchEmpty(int8_t const* const& g) noexcept;
+
+		// 返回一组控制码中 空 或 删除 的位图
+		static uint32_t GroupMatchEmptyOrDeleted(int8_t const* const& g) noexcept;
+
+		// 定位 h 的起始组
+		int GroupIndex(uint64_t const& h) const noexcept;
+
+		// 在 capacity 下为 hash 找第一个 空 或 删除 格子( 不比 key )
+		int FindInsertSlot(uint64_t const& h) const noexcept;
+
+		// 按新容量重建( 同时清掉墓碑 )
+		void Rehash(int const& newCapacity) noexcept;
+
+		// 用于 析构, Clear
+		void DeleteKVs() noexcept;
+	};
+
+
+	template <typename TK, typename TV>
+	using FlatDict_p = Ptr<FlatDict<TK, TV>>;
+
+	template <typename TK, typename TV>
+	using FlatDict_r = Ref<FlatDict<TK, TV>>;
+
+	template <typename TK, typename TV>
+	using FlatDict_u = Unique<FlatDict<TK, TV>>;
+
+	template <typename TK, typename TV>
+	using FlatDict_w = Weak<FlatDict<TK, TV>>;
+
+}
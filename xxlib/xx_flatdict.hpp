@@ -0,0 +1,378 @@
+﻿#pragma once
+namespace xx
+{
+	// 算放下 n 个数据所需的格子数( 2^N, 最少 16, 负载不超过 7/8 )
+	inline int FlatDictCalcCapacity(int const& n) noexcept
+	{
+		auto want = (size_t)n + (size_t)n / 7;
+		if (want <= 16) return 16;
+		return (int)MemPool::Round2n(want);
+	}
+
+	template <typename TK, typename TV>
+	FlatDict<TK, TV>::FlatDict(MemPool* const& mempool, int const& capacity)
+		: Object(mempool)
+	{
+		count = 0;
+		this->capacity = FlatDictCalcCapacity(capacity);
+		growthLeft = this->capacity - this->capacity / 8;
+		groupShift = 32 - (int)MemPool::Calc2n(this->capacity / groupWidth);
+		ctrls = (int8_t*)mempool->Alloc(this->capacity);
+		memset(ctrls, ctrlEmpty, this->capacity);
+		items = (Data*)mempool->Alloc(this->capacity * sizeof(Data));
+	}
+
+	template <typename TK, typename TV>
+	FlatDict<TK, TV>::~FlatDict()
+	{
+		DeleteKVs();
+		mempool->Free(ctrls);
+		mempool->Free(items);
+	}
+
+	template <typename TK, typename TV>
+	uint64_t FlatDict<TK, TV>::MixHash(uint32_t const& hashCode) noexcept
+	{
+		// 现有 HashFunc 对整数 / 指针 基本是原值, 直接取低位定位会扎堆. 乘黄金分割常数打散
+		return (uint64_t)hashCode * 0x9E3779B97F4A7C15ull;
+	}
+
+	template <typename TK, typename TV>
+	int FlatDict<TK, TV>::GroupIndex(uint64_t const& h) const noexcept
+	{
+		// 乘法散列的高位质量最好( 取中段的位 对 等差的指针 会严重扎堆 )
+		return (int)((h >> 32) >> groupShift);
+	}
+
+#ifndef XX_SSE2
+	// 标量版: 一组 16 字节拆成 2 个 uint64 做 SWAR. 每字节的结果位在 bit7, 收拢成每格 1 bit
+	inline uint32_t FlatDictCompactMask(uint64_t const& m) noexcept
+	{
+		return (uint32_t)(((m >> 7) * 0x0102040810204080ull) >> 56);
+	}
+#endif
+
+	template <typename TK, typename TV>
+	uint32_t FlatDict<TK, TV>::GroupMatch(int8_t const* const& g, int8_t const& h) noexcept
+	{
+#ifdef XX_SSE2
+		auto c = _mm_loadu_si128((__m128i const*)g);
+		return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), c));
+#else
+		// 找 0 字节的经典写法. 可能误报( 真 0 字节之上的一格 ), 调用方会再比 key, 不影响正确性
+		constexpr uint64_t lsbs = 0x0101010101010101ull, msbs = 0x8080808080808080ull;
+		uint64_t w[2];
+		memcpy(w, g, 16);
+		auto x0 = w[0] ^ (lsbs * (uint8_t)h);
+		auto x1 = w[1] ^ (lsbs * (uint8_t)h);
+		return FlatDictCompactMask((x0 - lsbs) & ~x0 & msbs) | (FlatDictCompactMask((x1 - lsbs) & ~x1 & msbs) << 8);
+#endif
+	}
+
+	template <typename TK, typename TV>
+	uint32_t FlatDict<TK, TV>::GroupMatchEmpty(int8_t const* const& g) noexcept
+	{
+#ifdef XX_SSE2
+		return GroupMatch(g, ctrlEmpty);
+#else
+		// 0x80 与 0xFE 的区别在 bit1. 精确匹配, 无误报
+		constexpr uint64_t msbs = 0x8080808080808080ull;
+		uint64_t w[2];
+		memcpy(w, g, 16);
+		return FlatDictCompactMask(w[0] & ~(w[0] << 6) & msbs) | (FlatDictCompactMask(w[1] & ~(w[1] << 6) & msbs) << 8);
+#endif
+	}
+
+	template <typename TK, typename TV>
+	uint32_t FlatDict<TK, TV>::GroupMatchEmptyOrDeleted(int8_t const* const& g) noexcept
+	{
+#ifdef XX_SSE2
+		return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((__m128i const*)g));
+#else
+		constexpr uint64_t msbs = 0x8080808080808080ull;
+		uint64_t w[2];
+		memcpy(w, g, 16);
+		return FlatDictCompactMask(w[0] & msbs) | (FlatDictCompactMask(w[1] & msbs) << 8);
+#endif
+	}
+
+	template <typename TK, typename TV>
+	int FlatDict<TK, TV>::FindInsertSlot(uint64_t const& h) const noexcept
+	{
+		// 按组做三角数探测( 组数为 2^N 时可遍历所有组 )
+		auto groupMask = (capacity / groupWidth) - 1;
+		auto gi = GroupIndex(h);
+		for (int step = 1;; ++step)
+		{
+			auto p = gi * groupWidth;
+			if (auto m = GroupMatchEmptyOrDeleted(ctrls + p)) return p + (int)Ctz64(m);
+			gi = (gi + step) & groupMask;
+		}
+	}
+
+	template <typename TK, typename TV>
+	template<typename K, typename V>
+	DictAddResult FlatDict<TK, TV>::Add(K&& k, V&& v, bool const& override) noexcept
+	{
+		assert(ctrls);
+
+		// 先按 Find 的路径扫一遍, 已存在则按 override 处理
+		auto h = MixHash(HashFunc<TK>::GetHashCode(k));
+		auto h2 = (int8_t)((h >> 25) & 0x7F);
+		auto groupMask = (capacity / groupWidth) - 1;
+		auto gi = GroupIndex(h);
+		for (int step = 1;; ++step)
+		{
+			auto p = gi * groupWidth;
+			for (auto m = GroupMatch(ctrls + p, h2); m; m &= m - 1)
+			{
+				auto i = p + (int)Ctz64(m);
+				if (ctrls[i] == h2 && EqualsFunc<TK>::EqualsTo(items[i].key, k))
+				{
+					if (override)                   // 允许覆盖 value
+					{
+						items[i].value.~TV();
+						new (&items[i].value) TV(std::forward<V>(v));
+						return DictAddResult{ true, i };
+					}
+					return DictAddResult{ false, i };
+				}
+			}
+			if (GroupMatchEmpty(ctrls + p)) break;
+			gi = (gi + step) & groupMask;
+		}
+
+		// 没找到则新增. 占用墓碑不消耗 growthLeft, 占用空格子且名额用光则先重建
+		auto index = FindInsertSlot(h);
+		if (!growthLeft && ctrls[index] == ctrlEmpty)
+		{
+			// 有效数据不足上限一半, 说明主要是墓碑, 原尺寸重建即可. 否则 2 倍扩容
+			Rehash(count * 2 > capacity - capacity / 8 ? capacity * 2 : capacity);
+			index = FindInsertSlot(h);
+		}
+		if (ctrls[index] == ctrlEmpty)
+		{
+			--growthLeft;
+		}
+		ctrls[index] = h2;
+		new (&items[index].key) TK(std::forward<K>(k));
+		new (&items[index].value) TV(std::forward<V>(v));
+		++count;
+		return DictAddResult{ true, index };
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::Rehash(int const& newCapacity) noexcept
+	{
+		auto oldCtrls = ctrls;
+		auto oldItems = items;
+		auto oldCapacity = capacity;
+
+		capacity = newCapacity;
+		growthLeft = newCapacity - newCapacity / 8 - count;
+		groupShift = 32 - (int)MemPool::Calc2n(newCapacity / groupWidth);
+		ctrls = (int8_t*)mempool->Alloc(newCapacity);
+		memset(ctrls, ctrlEmpty, newCapacity);
+		items = (Data*)mempool->Alloc(newCapacity * sizeof(Data));
+
+		// 新表里没有墓碑也不会有重复 key, 直接找空位放
+		for (int i = 0; i < oldCapacity; ++i)
+		{
+			if (oldCtrls[i] < 0) continue;
+			auto h = MixHash(HashFunc<TK>::GetHashCode(oldItems[i].key));
+			auto index = FindInsertSlot(h);
+			ctrls[index] = (int8_t)((h >> 25) & 0x7F);
+			if constexpr (IsTrivial_v<TK> && IsTrivial_v<TV>)
+			{
+				memcpy((void*)&items[index], &oldItems[i], sizeof(Data));
+			}
+			else
+			{
+				new (&items[index].key) TK((TK&&)oldItems[i].key);
+				oldItems[i].key.TK::~TK();
+				new (&items[index].value) TV((TV&&)oldItems[i].value);
+				oldItems[i].value.TV::~TV();
+			}
+		}
+		mempool->Free(oldCtrls);
+		mempool->Free(oldItems);
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::Reserve(int capacity) noexcept
+	{
+		assert(ctrls);
+		auto newCapacity = capacity ? FlatDictCalcCapacity(capacity) : this->capacity * 2;   // 0: 2倍扩容
+		if (newCapacity <= this->capacity) return;
+		Rehash(newCapacity);
+	}
+
+	template <typename TK, typename TV>
+	int FlatDict<TK, TV>::Find(TK const& k) const noexcept
+	{
+		assert(ctrls);
+		auto h = MixHash(HashFunc<TK>::GetHashCode(k));
+		auto h2 = (int8_t)((h >> 25) & 0x7F);
+		auto groupMask = (capacity / groupWidth) - 1;
+		auto gi = GroupIndex(h);
+		for (int step = 1;; ++step)
+		{
+			auto p = gi * groupWidth;
+			for (auto m = GroupMatch(ctrls + p, h2); m; m &= m - 1)
+			{
+				auto i = p + (int)Ctz64(m);
+				if (ctrls[i] == h2 && EqualsFunc<TK>::EqualsTo(items[i].key, k))
+				{
+					return i;
+				}
+			}
+			if (GroupMatchEmpty(ctrls + p)) return -1;   // 组内有空格子, 说明插入时没有越过此组
+			gi = (gi + step) & groupMask;
+		}
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::RemoveAt(int const& idx) noexcept
+	{
+		assert(ctrls);
+		assert(idx >= 0 && idx < capacity && ctrls[idx] >= 0);
+		items[idx].key.~TK();
+		items[idx].value.~TV();
+		--count;
+
+		// 所在组还有空格子, 则探测链不会穿过此组, 可直接置空. 否则只能立墓碑
+		if (GroupMatchEmpty(ctrls + (idx & ~(groupWidth - 1))))
+		{
+			ctrls[idx] = ctrlEmpty;
+			++growthLeft;
+		}
+		else
+		{
+			ctrls[idx] = ctrlDeleted;
+		}
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::Clear(std::function<void(Data&)> killer) noexcept
+	{
+		if (killer)
+		{
+			for (decltype(auto) data : *this) killer(data);
+		}
+
+		assert(ctrls);
+		if (!count && growthLeft == capacity - capacity / 8) return;
+		DeleteKVs();
+		memset(ctrls, ctrlEmpty, capacity);
+		count = 0;
+		growthLeft = capacity - capacity / 8;
+	}
+
+	template <typename TK, typename TV>
+	template<typename K>
+	TV& FlatDict<TK, TV>::operator[](K &&k) noexcept
+	{
+		assert(ctrls);
+		int idx = Find(k);
+		if (idx < 0)
+		{
+			if constexpr (CtorTakesMemPool_v<TV>)
+			{
+				idx = Add(std::forward<K>(k), TV(mempool), true).index;
+			}
+			else
+			{
+				idx = Add(std::forward<K>(k), TV(), true).index;
+			}
+		}
+		return items[idx].value;
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::Remove(TK const &k) noexcept
+	{
+		assert(ctrls);
+		auto idx = Find(k);
+		if (idx != -1)
+		{
+			RemoveAt(idx);
+		}
+	}
+
+	template <typename TK, typename TV>
+	void FlatDict<TK, TV>::DeleteKVs() noexcept
+	{
+		assert(ctrls);
+		if (!count) return;
+		for (int i = 0; i < capacity; ++i)
+		{
+			if (ctrls[i] >= 0)
+			{
+				items[i].key.~TK();
+				items[i].value.~TV();
+				ctrls[i] = ctrlDeleted;
+			}
+		}
+	}
+
+	template <typename TK, typename TV>
+	uint32_t FlatDict<TK, TV>::Count() const noexcept
+	{
+		assert(ctrls);
+		return uint32_t(count);
+	}
+
+	template <typename TK, typename TV>
+	bool FlatDict<TK, TV>::Empty() noexcept
+	{
+		assert(ctrls);
+		return count == 0;
+	}
+
+	template <typename TK, typename TV>
+	bool FlatDict<TK, TV>::TryGetValue(TK const& key, TV& outV) noexcept
+	{
+		int idx = Find(key);
+		if (idx >= 0)
+		{
+			outV = items[idx].value;
+			return true;
+		}
+		return false;
+	}
+
+	template <typename TK, typename TV>
+	template<typename K>
+	TV& FlatDict<TK, TV>::At(K&& key) noexcept
+	{
+		return operator[](std::forward<K>(key));
+	}
+
+	template <typename TK, typename TV>
+	TV& FlatDict<TK, TV>::ValueAt(int const& idx) noexcept
+	{
+		assert(ctrls);
+		assert(idx >= 0 && idx < capacity && ctrls[idx] >= 0);
+		return items[idx].value;
+	}
+
+	template <typename TK, typename TV>
+	TK const& FlatDict<TK, TV>::KeyAt(int const& idx) const noexcept
+	{
+		assert(idx >= 0 && idx < capacity && ctrls[idx] >= 0);
+		return items[idx].key;
+	}
+
+	template <typename TK, typename TV>
+	TV const& FlatDict<TK, TV>::ValueAt(int const& idx) const noexcept
+	{
+		return const_cast<FlatDict*>(this)->ValueAt(idx);
+	}
+
+	template <typename TK, typename TV>
+	bool FlatDict<TK, TV>::IndexExists(int const& idx) const noexcept
+	{
+		return idx >= 0 && idx < capacity && ctrls[idx] >= 0;
+	}
+
+}
@@ -76,7 +76,7 @@ namespace xx
 	{
 		static uint32_t GetHashCode(Guid const& in) noexcept
 		{
-			return ((uint32_t*)&in)[0] ^ ((uint32_t*)&in)[1] ^ ((uint32_t*)&in)[2] ^ ((uint32_t*)&in)[3];
+			return (uint32_t)Hash16(in.part1, in.part2);
 		}
 	};
 
@@ -97,6 +97,16 @@ namespace xx
 			bb.offset += sizeof(Guid);
 			return 0;
 		}
+		static inline void CalcLen(BBuffer& bb, Guid const& in, size_t& len) noexcept
+		{
+			len += sizeof(Guid);
+		}
+		static inline int Skip(BBuffer& bb) noexcept
+		{
+			if (bb.offset + sizeof(Guid) > bb.dataLen) return -1;
+			bb.offset += sizeof(Guid);
+			return 0;
+		}
 	};
 
 }
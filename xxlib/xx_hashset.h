@@ -24,6 +24,12 @@ namespace xx
 		int                 bucketsLen;             // 桶数组长( 质数 )
 		int                *buckets;                // 桶数组
 		Node               *nodes;                  // 节点数组
+
+		int                 incrementalThreshold;   // 扩容时数据量 >= 此值则走增量迁移. 0: 关闭
+		int                 oldBucketsLen;          // 增量迁移中: 旧桶数组长
+		int                *oldBuckets;             // 增量迁移中: 旧桶数组( 尚未迁走的链仍挂在这里 ). 迁完即释放并置空
+		int                 rehashIndex;            // 增量迁移中: 下一个待迁移的旧桶下标
+		static constexpr int rehashStepBuckets = 4; // 每次 Add / Remove 顺带迁移的旧桶数
 	public:
 
 		explicit HashSet(MemPool* const& mempool, int const& capacity = 16) noexcept;
@@ -34,6 +40,9 @@ namespace xx
 		// 只支持没数据时扩容或空间用尽扩容( 如果不这样限制, 扩容时的 遍历损耗 略大 )
 		void Reserve(int capacity = 0) noexcept;
 
+		// 开启增量扩容( 同 Dict::EnableIncrementalRehash )
+		void EnableIncrementalRehash(int const& threshold = 65536) noexcept;
+
 		// 返回 true: 添加成功. false: 已存在相同的值
 		template<typename K>
 		bool Add(K&& k) noexcept;
@@ -85,6 +94,12 @@ namespace xx
 	protected:
 		// 用于 析构, Clear
 		void DeleteKs() noexcept;
+
+		// 增量迁移: 将旧桶 oldBucket 上的整条链挂到新桶数组
+		void MigrateBucket(uint32_t const& oldBucket) noexcept;
+
+		// 增量迁移: 按顺序迁移 n 个旧桶. 全部迁完则释放旧桶数组
+		void RehashStep(int n) noexcept;
 	};
 
 
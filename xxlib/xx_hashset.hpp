@@ -12,6 +12,10 @@ namespace xx
 		buckets = (int*)mempool->Alloc(bucketsLen * sizeof(int));
 		memset(buckets, -1, bucketsLen * sizeof(int));  // -1 代表 "空"
 		nodes = (Node*)mempool->Alloc(bucketsLen * sizeof(Node));
+		incrementalThreshold = 0;
+		oldBucketsLen = 0;
+		oldBuckets = nullptr;
+		rehashIndex = 0;
 	}
 
 	template <typename TK>
@@ -20,6 +24,54 @@ namespace xx
 		DeleteKs();
 		mempool->Free(buckets);
 		mempool->Free(nodes);
+		if (oldBuckets)
+		{
+			mempool->Free(oldBuckets);
+		}
+	}
+
+	template <typename TK>
+	void HashSet<TK>::EnableIncrementalRehash(int const& threshold) noexcept
+	{
+		assert(threshold > 0);
+		incrementalThreshold = threshold;
+	}
+
+	template <typename TK>
+	void HashSet<TK>::MigrateBucket(uint32_t const& oldBucket) noexcept
+	{
+		assert(oldBuckets);
+		for (int i = oldBuckets[oldBucket]; i >= 0;)
+		{
+			auto next = nodes[i].next;
+			auto index = nodes[i].hashCode % bucketsLen;
+			if (buckets[index] >= 0)
+			{
+				nodes[buckets[index]].prev = i;
+			}
+			nodes[i].prev = -1;
+			nodes[i].next = buckets[index];
+			buckets[index] = i;
+			i = next;
+		}
+		oldBuckets[oldBucket] = -1;
+	}
+
+	template <typename TK>
+	void HashSet<TK>::RehashStep(int n) noexcept
+	{
+		assert(oldBuckets);
+		for (; n > 0 && rehashIndex < oldBucketsLen; --n)
+		{
+			MigrateBucket(rehashIndex++);
+		}
+		if (rehashIndex == oldBucketsLen)
+		{
+			mempool->Free(oldBuckets);
+			oldBuckets = nullptr;
+			oldBucketsLen = 0;
+			rehashIndex = 0;
+		}
 	}
 
 	template <typename TK>
@@ -30,6 +82,11 @@ namespace xx
 
 		// hash 按桶数取模 定位到具体 链表, 扫找
 		auto hashCode = HashFunc<TK>::GetHashCode(k);
+		if (oldBuckets)                             // 增量迁移中: 先把 key 所在旧链迁过来, 再顺带推进几个
+		{
+			MigrateBucket(hashCode % (uint32_t)oldBucketsLen);
+			RehashStep(rehashStepBuckets);
+		}
 		auto targetBucket = hashCode % bucketsLen;
 		for (int i = buckets[targetBucket]; i >= 0; i = nodes[i].next)
 		{
@@ -82,16 +139,32 @@ namespace xx
 		assert(buckets);
 		assert(count == 0 || count == bucketsLen);          // 确保扩容函数使用情型
 
+		// 上一轮增量迁移还没完成, 先迁完
+		if (oldBuckets)
+		{
+			RehashStep(oldBucketsLen);
+		}
+
 		// 得到空间利用率最高的扩容长度并直接修改 bucketsLen( count 为当前数据长 )
 		if (capacity == 0)
 		{
 			capacity = count * 2;                           // 2倍扩容
 		}
 		if (capacity <= bucketsLen) return;
+		auto prevBucketsLen = bucketsLen;
 		bucketsLen = (int)GetPrime(capacity, sizeof(Node));
 
-		// 桶扩容并全部初始化( 后面会重新映射一次 )
-		mempool->Free(buckets);
+		// 桶扩容并全部初始化( 后面会重新映射一次 ). 增量模式下旧桶保留, 链表原样挂着慢慢迁
+		if (incrementalThreshold && count >= incrementalThreshold)
+		{
+			oldBuckets = buckets;
+			oldBucketsLen = prevBucketsLen;
+			rehashIndex = 0;
+		}
+		else
+		{
+			mempool->Free(buckets);
+		}
 		buckets = (int*)mempool->Alloc(bucketsLen * sizeof(int));
 		memset(buckets, -1, bucketsLen * sizeof(int));
 
@@ -105,12 +178,19 @@ namespace xx
 			auto newItems = (Node*)mempool->Alloc(bucketsLen * sizeof(Node));
 			for (int i = 0; i < count; ++i)
 			{
-				new (&newItems[i].key) TK((TK&&)nodes[i].key);
-				nodes[i].key.TK::~TK();
+				newItems[i].hashCode = nodes[i].hashCode;   // 下面重建链表要用
+				newItems[i].next = nodes[i].next;
+				newItems[i].prev = nodes[i].prev;
+				if (nodes[i].prev != -2)                    // 已删除的格子 key 已析构
+				{
+					new (&newItems[i].key) TK((TK&&)nodes[i].key);
+					nodes[i].key.TK::~TK();
+				}
 			}
 			mempool->Free(nodes);
 			nodes = newItems;
 		}
+		if (oldBuckets) return;
 
 		// 遍历所有节点, 重构桶及链表( 扩容情况下没有节点空洞 )
 		for (int i = 0; i < count; i++)
@@ -138,6 +218,16 @@ namespace xx
 				return true;
 			}
 		}
+		if (oldBuckets)                             // 增量迁移中: 还没迁走的旧链也要找( 已迁的旧桶为 -1 )
+		{
+			for (int i = oldBuckets[hashCode % (uint32_t)oldBucketsLen]; i >= 0; i = nodes[i].next)
+			{
+				if (nodes[i].hashCode == hashCode && EqualsFunc<TK>::EqualsTo(nodes[i].key, k))
+				{
+					return true;
+				}
+			}
+		}
 		return false;
 	}
 
@@ -147,6 +237,11 @@ namespace xx
 		assert(buckets);
 
 		auto hashCode = HashFunc<TK>::GetHashCode(k);
+		if (oldBuckets)                             // 增量迁移中: 先把 key 所在旧链迁过来, 再顺带推进几个
+		{
+			MigrateBucket(hashCode % (uint32_t)oldBucketsLen);
+			RehashStep(rehashStepBuckets);
+		}
 		for (int i = buckets[hashCode % bucketsLen]; i >= 0; i = nodes[i].next)
 		{
 			if (nodes[i].hashCode == hashCode && EqualsFunc<TK>::EqualsTo(nodes[i].key, k))
@@ -181,6 +276,13 @@ namespace xx
 	void HashSet<TK>::Clear() noexcept
 	{
 		assert(buckets);
+		if (oldBuckets)
+		{
+			mempool->Free(oldBuckets);
+			oldBuckets = nullptr;
+			oldBucketsLen = 0;
+			rehashIndex = 0;
+		}
 		if (!count) return;
 		DeleteKs();
 		memset(buckets, -1, bucketsLen * sizeof(int));
@@ -25,6 +25,25 @@ namespace xx
 	};
 
 
+	// 字节串 hash 相关( wyhash 风格: 64x64->128 乘法混合, 每步 16 字节, 长串 48 字节 3 路并行, 不要求对齐 )
+
+	// 当前种子( 已混合, 不能为 0: 短 key 会乘 0 ). 默认值即 SetHashSeed(0) 的结果, 跨进程可复现. 不要直接改, 用 SetHashSeed
+	inline uint64_t hashSeed = 0x1ff5c2923a788d2cull;
+
+	// 设置 字串 / buf / Guid 的 hash 种子. 面对客户端可控的 key 时, 进程启动后( 任何 Dict 建立前 )设为随机值, 防 hash flooding
+	// 已有数据的 Dict / HashSet 在改种子后将查不到旧 key
+	void SetHashSeed(uint64_t const& seed) noexcept;
+
+	// 64x64->128 乘法, 返回 高位 ^ 低位
+	uint64_t HashMix(uint64_t const& a, uint64_t const& b) noexcept;
+
+	// 算 buf 的 hash. seed 为 SetHashSeed 处理后的值, 一般不传
+	uint64_t HashBytes(void const* const& buf, size_t const& len, uint64_t const& seed = hashSeed) noexcept;
+
+	// 定长 16 字节( 例如 Guid ) 的快速版
+	uint64_t Hash16(uint64_t const& a, uint64_t const& b, uint64_t const& seed = hashSeed) noexcept;
+
+
 	/**************************************************************************************************/
 	// 类型--操作适配模板区
 	/**************************************************************************************************/
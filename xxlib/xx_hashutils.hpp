@@ -42,6 +42,120 @@ namespace xx
 
 
 
+	// wyhash 的 4 个常数
+	constexpr uint64_t hashSecrets[] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+	inline void HashMum(uint64_t& a, uint64_t& b) noexcept
+	{
+#if defined(__SIZEOF_INT128__)
+		auto r = (__uint128_t)a * b;
+		a = (uint64_t)r;
+		b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+#else
+		// 32 位平台: 拆成 4 个 32x32 乘法
+		uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+		uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+		auto lo = t + (rm1 << 32);
+		c += lo < t;
+		b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+		a = lo;
+#endif
+	}
+
+	inline uint64_t HashMix(uint64_t const& a, uint64_t const& b) noexcept
+	{
+		auto x = a, y = b;
+		HashMum(x, y);
+		return x ^ y;
+	}
+
+	inline void SetHashSeed(uint64_t const& seed) noexcept
+	{
+		hashSeed = HashMix(seed ^ hashSecrets[0], hashSecrets[1]);
+	}
+
+	// 不对齐读( memcpy 会被编译器优化为单条 mov ). 按小尾处理
+	inline uint64_t HashRead8(uint8_t const* const& p) noexcept
+	{
+		uint64_t v;
+		memcpy(&v, p, 8);
+		return v;
+	}
+	inline uint64_t HashRead4(uint8_t const* const& p) noexcept
+	{
+		uint32_t v;
+		memcpy(&v, p, 4);
+		return v;
+	}
+
+	inline uint64_t HashBytes(void const* const& buf, size_t const& len, uint64_t const& seed) noexcept
+	{
+		auto p = (uint8_t const*)buf;
+		auto s = seed;
+		uint64_t a, b;
+		if (len <= 16)
+		{
+			if (len >= 4)
+			{
+				// 4 ~ 16 字节: 头尾各取 2 个 4 字节( 可重叠 ), 无分支覆盖全部输入
+				auto o = (len >> 3) << 2;
+				a = (HashRead4(p) << 32) | HashRead4(p + o);
+				b = (HashRead4(p + len - 4) << 32) | HashRead4(p + len - 4 - o);
+			}
+			else if (len)
+			{
+				a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+				b = 0;
+			}
+			else
+			{
+				a = b = 0;
+			}
+		}
+		else
+		{
+			auto i = len;
+			if (i > 48)
+			{
+				// 3 路独立链, 利用乘法器流水
+				auto s1 = s, s2 = s;
+				do
+				{
+					s = HashMix(HashRead8(p) ^ hashSecrets[1], HashRead8(p + 8) ^ s);
+					s1 = HashMix(HashRead8(p + 16) ^ hashSecrets[2], HashRead8(p + 24) ^ s1);
+					s2 = HashMix(HashRead8(p + 32) ^ hashSecrets[3], HashRead8(p + 40) ^ s2);
+					p += 48;
+					i -= 48;
+				} while (i > 48);
+				s ^= s1 ^ s2;
+			}
+			while (i > 16)
+			{
+				s = HashMix(HashRead8(p) ^ hashSecrets[1], HashRead8(p + 8) ^ s);
+				i -= 16;
+				p += 16;
+			}
+			// 最后 16 字节( 可与前面重叠 )
+			a = HashRead8(p + i - 16);
+			b = HashRead8(p + i - 8);
+		}
+		a ^= hashSecrets[1];
+		b ^= s;
+		HashMum(a, b);
+		return HashMix(a ^ hashSecrets[0] ^ len, b ^ hashSecrets[1]);
+	}
+
+	inline uint64_t Hash16(uint64_t const& a, uint64_t const& b, uint64_t const& seed) noexcept
+	{
+		auto x = a ^ hashSecrets[1], y = b ^ seed;
+		HashMum(x, y);
+		return HashMix(x ^ hashSecrets[0] ^ 16, y ^ hashSecrets[1]);
+	}
+
+
+
 
 
 
@@ -99,39 +213,13 @@ namespace xx
 		}
 	};
 
-	// 适配一段 buf
+	// 适配一段 buf( 不要求对齐 )
 	template<>
 	struct HashFunc<std::pair<char*, size_t>, void>
 	{
-		// 抄自微软 .net 源代码
-		// todo: 未来考虑是不是换成什么 xxhash 开源项目之类
 		static uint32_t GetHashCode(std::pair<char*, size_t> const& in) noexcept
 		{
-			auto& buf = in.first;
-			auto& len = in.second;
-
-			assert((size_t)buf % 4 == 0);		// buf 要求 4 字节对齐
-			if (!len)
-			{
-				return 0;
-			}
-			int32_t n2 = 0x15051505, n1 = 0x15051505;
-			uint32_t mod = len % 8, i = 0;
-			for (; i < len - mod; i += 8)
-			{
-				n1 = (((n1 << 5) + n1) + (n1 >> 0x1b)) ^ *(int32_t*)(buf + i);
-				n2 = (((n2 << 5) + n2) + (n2 >> 0x1b)) ^ *(int32_t*)(buf + i + 4);
-			}
-			if (mod > 4)
-			{
-				n1 = (((n1 << 5) + n1) + (n1 >> 0x1b)) ^ *(int32_t*)(buf + i);
-				n2 = (((n2 << 5) + n2) + (n2 >> 0x1b)) ^ (*(int32_t*)(buf + i + 4) & (0xFFFFFFFF >> ((8 - mod) * 8)));
-			}
-			else if (mod)
-			{
-				n1 = (((n1 << 5) + n1) + (n1 >> 0x1b)) ^ (*(int32_t*)(buf + i) & (0xFFFFFFFF >> ((4 - mod) * 8)));
-			}
-			return n2 + n1 * 0x5d588b65;
+			return (uint32_t)HashBytes(in.first, in.second);
 		}
 	};
 
@@ -141,34 +229,8 @@ namespace xx
 	{
 		static uint32_t GetHashCode(char const* const& in) noexcept
 		{
-			// come from zeno
-			uint32_t seed = 0x811C9DC5U;
-			if (!in) return seed;
-			auto size = strlen(in);
-			if (!size) return seed;
-			const char* src = (const char*)in;
-			const uint32_t fnv_prime = 0x1000193U;
-			while (size--)
-			{
-				seed ^= ((uint32_t)(*src++));
-				seed *= fnv_prime;
-			}
-			return seed;
-
-			//auto len = strlen(in);
-			//uint32_t hash, i;
-			//for (hash = i = 0; i < len; ++i)
-			//{
-			//	hash += in[i];
-			//	hash += (hash << 10);
-			//	hash ^= (hash >> 6);
-			//}
-			//hash += (hash << 3);
-			//hash ^= (hash >> 11);
-			//hash += (hash << 15);
-			//return hash;
-
-			//return HashFunc<std::pair<char*, size_t>>::GetHashCode(std::make_pair((char*)in, strlen(in)));
+			if (!in) return 0;
+			return (uint32_t)HashBytes(in, strlen(in));
 		}
 	};
 
@@ -178,7 +240,7 @@ namespace xx
 	{
 		static uint32_t GetHashCode(std::string const& in) noexcept
 		{
-			return HashFunc<std::pair<char*, size_t>>::GetHashCode(std::make_pair((char*)in.data(), in.size()));
+			return (uint32_t)HashBytes(in.data(), in.size());
 		}
 	};
 
@@ -0,0 +1,29 @@
+﻿#pragma once
+namespace xx
+{
+	/**************************************************************************************************/
+	// 序列化数据 直接转 json( 不创建对象. 供 http 管理接口, 抓包打印 等 )
+	// 各类型按 JsonFunc 边读边写. 对象按 typeId 查 MemPool::jsoners( 即 pkggen 生成的 T::WriteJson )
+	// 格式同生成物的 ToString: { "pkgTypeName":"...", "pkgTypeId":N, 成员... }, 只是没有多余空格, 空指针为 null
+	/**************************************************************************************************/
+
+	class BBuffer;
+	class String;
+
+	// 基础适配模板
+	template<typename T, typename ENABLE = void>
+	struct JsonFunc
+	{
+		static_assert(!std::is_same_v<ENABLE, ENABLE>, "JsonFunc 未适配该类型");
+
+		// 从 bb 读出一个 T 的序列化数据 并以 json 追加到 s
+		static int WriteTo(BBuffer& bb, String& s) noexcept;
+	};
+
+	// 追加 json 字串( 含引号. 转义 " \ 及控制字符, 其余 utf8 原样 )
+	void JsonAppendString(String& s, char const* const& buf, size_t const& len) noexcept;
+
+	// 追加浮点: 可还原的最短写法. nan / inf 写 null
+	void JsonAppendNumber(String& s, double const& v) noexcept;
+	void JsonAppendNumber(String& s, float const& v) noexcept;
+}
@@ -0,0 +1,194 @@
+﻿#pragma once
+namespace xx
+{
+	inline void JsonAppendString(String& s, char const* const& buf, size_t const& len) noexcept
+	{
+		static const char hexs[] = "0123456789abcdef";
+		s.Reserve(s.dataLen + len + 2);
+		s.buf[s.dataLen++] = '"';
+		size_t i = 0, begin = 0;
+		for (; i < len; ++i)
+		{
+			auto c = (uint8_t)buf[i];
+			if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+			// 先整段 copy 不需转义的部分
+			s.Reserve(s.dataLen + (i - begin) + 6 + (len - i) + 1);
+			memcpy(s.buf + s.dataLen, buf + begin, i - begin);
+			s.dataLen += i - begin;
+			begin = i + 1;
+
+			auto p = s.buf + s.dataLen;
+			p[0] = '\\';
+			switch (c)
+			{
+			case '"': p[1] = '"'; s.dataLen += 2; break;
+			case '\\': p[1] = '\\'; s.dataLen += 2; break;
+			case '\b': p[1] = 'b'; s.dataLen += 2; break;
+			case '\f': p[1] = 'f'; s.dataLen += 2; break;
+			case '\n': p[1] = 'n'; s.dataLen += 2; break;
+			case '\r': p[1] = 'r'; s.dataLen += 2; break;
+			case '\t': p[1] = 't'; s.dataLen += 2; break;
+			default:
+				p[1] = 'u';
+				p[2] = '0';
+				p[3] = '0';
+				p[4] = hexs[c >> 4];
+				p[5] = hexs[c & 15];
+				s.dataLen += 6;
+			}
+		}
+		s.Reserve(s.dataLen + (i - begin) + 1);
+		memcpy(s.buf + s.dataLen, buf + begin, i - begin);
+		s.dataLen += i - begin;
+		s.buf[s.dataLen++] = '"';
+	}
+
+	inline void JsonAppendNumber(String& s, double const& v) noexcept
+	{
+		if (!std::isfinite(v))
+		{
+			s.Append("null");
+			return;
+		}
+		s.Reserve(s.dataLen + 32);
+#if defined(__cpp_lib_to_chars)
+		s.dataLen = std::to_chars(s.buf + s.dataLen, s.buf + s.bufLen, v).ptr - s.buf;
+#else
+		// 没有 to_chars 时 逐级加精度 直到能还原
+		for (int p = 15; p <= 17; ++p)
+		{
+			auto n = snprintf(s.buf + s.dataLen, 32, "%.*g", p, v);
+			if (p == 17 || strtod(s.buf + s.dataLen, nullptr) == v)
+			{
+				s.dataLen += n;
+				break;
+			}
+		}
+#endif
+	}
+
+	inline void JsonAppendNumber(String& s, float const& v) noexcept
+	{
+		if (!std::isfinite(v))
+		{
+			s.Append("null");
+			return;
+		}
+		s.Reserve(s.dataLen + 32);
+#if defined(__cpp_lib_to_chars)
+		s.dataLen = std::to_chars(s.buf + s.dataLen, s.buf + s.bufLen, v).ptr - s.buf;
+#else
+		for (int p = 6; p <= 9; ++p)
+		{
+			auto n = snprintf(s.buf + s.dataLen, 32, "%.*g", p, (double)v);
+			if (p == 9 || strtof(s.buf + s.dataLen, nullptr) == v)
+			{
+				s.dataLen += n;
+				break;
+			}
+		}
+#endif
+	}
+
+
+	// 适配 bool
+	template<>
+	struct JsonFunc<bool, void>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			bool v;
+			if (int r = bb.Read(v)) return r;
+			s.Append(v ? "true" : "false");
+			return 0;
+		}
+	};
+
+	// 适配 整数 / enum( 按原始数据类型 )
+	template<typename T>
+	struct JsonFunc<T, std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>>>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			T v;
+			if (int r = bb.Read(v)) return r;
+			if constexpr (std::is_enum_v<T>)
+			{
+				s.Append((std::underlying_type_t<T>)v);
+			}
+			else if constexpr (sizeof(T) == 1)
+			{
+				s.Append((int)v);			// char 类也写数字
+			}
+			else
+			{
+				s.Append(v);
+			}
+			return 0;
+		}
+	};
+
+	// 适配 浮点
+	template<typename T>
+	struct JsonFunc<T, std::enable_if_t<std::is_floating_point_v<T>>>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			T v;
+			if (int r = bb.Read(v)) return r;
+			JsonAppendNumber(s, v);
+			return 0;
+		}
+	};
+
+	// 适配 Object 值类型
+	template<typename T>
+	struct JsonFunc<T, std::enable_if_t<std::is_base_of_v<Object, T>>>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			return T::WriteJson(bb, s);
+		}
+	};
+
+	// 适配 Ptr<T>, Ref<T>( 按实际 typeId 转 )
+	template<typename T>
+	struct JsonFunc<T, std::enable_if_t<IsPtr_v<T> || IsRef_v<T>>>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			return bb.PtrToJson(s);
+		}
+	};
+
+	// 适配 std::optional<T>
+	template<typename T>
+	struct JsonFunc<std::optional<T>, void>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			uint8_t hasValue = 0;
+			if (int r = bb.Read(hasValue)) return r;
+			if (!hasValue)
+			{
+				s.Append("null");
+				return 0;
+			}
+			return JsonFunc<T>::WriteTo(bb, s);
+		}
+	};
+
+	// 适配 Guid( 写成字串 )
+	template<>
+	struct JsonFunc<Guid, void>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			Guid v(false);
+			if (int r = bb.Read(v)) return r;
+			s.Append('"', v, '"');
+			return 0;
+		}
+	};
+}
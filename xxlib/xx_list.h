@@ -17,7 +17,8 @@ namespace xx
 		List(List const&o) = delete;
 		List& operator=(List const&o) = delete;
 
-		void Reserve(size_t const& capacity) noexcept;
+		void Reserve(size_t const& capacity) noexcept;			// 分配失败( 超出内存预算 )时 abort. 紧随其后直接写入的地方( Add 等 )都依赖它. BBuffer 另有不 abort 的版本
+		int TryReserve(size_t const& capacity) noexcept;		// 分配失败( 超出内存预算 )时 保持原样 并返回非 0. 用于能应对失败的地方( 例如收包 )
 		size_t Resize(size_t const& len) noexcept;			// 如果不想初始化扩容的单元, 直接 Reserve + 改 dataLen
 
 		T const& operator[](size_t const& idx) const noexcept;
@@ -67,15 +68,23 @@ namespace xx
 		Iter end() const noexcept { return Iter{ buf + dataLen }; }
 
 
-		// Object 接口支持
+		// Object 接口支持. 元素可打包且 bb.packedList 为 true 时 以 长度 + 元素原始字节 读写( 见 IsPackable_v )
 		List(BBuffer* const& bb);
 		void ToBBuffer(BBuffer& bb) const noexcept override;
 		int FromBBuffer(BBuffer& bb) noexcept override;
+		void CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept override;
+		static int SkipBBuffer(BBuffer& bb) noexcept;
+		static int WriteJson(BBuffer& bb, String& s) noexcept;
 
 		void ToString(String& s) const noexcept override;
 	};
 
 
+	// 判断 List<T> 的元素能否以原始字节打包读写( 数值, 枚举, 以及不含指针的 POD 结构体. 与别的语言互通时 只用数值 )
+	template<typename T>
+	constexpr bool IsPackable_v = std::is_arithmetic_v<T> || std::is_enum_v<T> || (std::is_class_v<T> && std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>);
+
+
 	template<typename T>
 	using List_p = Ptr<List<T>>;
 
@@ -12,11 +12,10 @@ namespace xx
 		}
 		else
 		{
-			// 充分利用 2^n 空间
-			auto bufByteLen = MemPool::Round2n(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
+			// 充分利用 尺寸档位 空间
+			auto bufByteLen = MemPool::RoundSize(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
 			buf = (T*)mempool->Alloc(bufByteLen);
-			assert(buf);
-			bufLen = bufByteLen / sizeof(T);
+			bufLen = buf ? bufByteLen / sizeof(T) : 0;				// 失败( 超出内存预算 )时 留待首次写入前的 Reserve 处理
 		}
 		dataLen = 0;
 	}
@@ -44,27 +43,38 @@ namespace xx
 	void List<T>::Reserve(size_t const& capacity) noexcept
 	{
 		if (capacity <= bufLen) return;
+		if (TryReserve(capacity)) abort();							// 调用方不检查, 与其越界写 不如就地终止
+	}
 
-		auto newBufByteLen = MemPool::Round2n(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
-		auto newBuf = (T*)mempool->Alloc(newBufByteLen);
-		assert(newBuf);
+	template<typename T>
+	int List<T>::TryReserve(size_t const& capacity) noexcept
+	{
+		if (capacity <= bufLen) return 0;
+
+		// 尺寸档位比 2^n 细, 扩容时至少增长 1.5 倍, 以免逐个 Add 时频繁搬迁
+		auto newBufByteLen = MemPool::RoundSize(std::max(capacity, bufLen + bufLen / 2) * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
 
 		if constexpr(IsTrivial_v<T>)
 		{
-			memcpy(newBuf, buf, dataLen * sizeof(T));
+			// 走 Realloc 以便大块内存用 mremap 扩容
+			auto newBuf = (T*)mempool->Realloc(buf, newBufByteLen, dataLen * sizeof(T));
+			if (!newBuf) return -1;									// 失败时( 超出内存预算 ) 保持原样
+			buf = newBuf;
 		}
 		else
 		{
+			auto newBuf = (T*)mempool->Alloc(newBufByteLen);
+			if (!newBuf) return -1;
 			for (size_t i = 0; i < dataLen; ++i)
 			{
 				new (&newBuf[i]) T((T&&)buf[i]);
 				buf[i].~T();
 			}
+			if (buf) mempool->Free(buf);
+			buf = newBuf;
 		}
-
-		if (buf) mempool->Free(buf);
-		buf = newBuf;
 		bufLen = size_t(newBufByteLen / sizeof(T));
+		return 0;
 	}
 
 	template<typename T>
@@ -342,49 +352,149 @@ namespace xx
 	template<typename T>
 	void List<T>::ToBBuffer(BBuffer& bb) const noexcept
 	{
-		bb.Reserve(bb.dataLen + 5 + dataLen * sizeof(T));
+		// 打包标记只作用于当前这一个 List
+		auto packed = bb.packedList;
+		bb.packedList = false;
+
+		bb.Reserve(bb.dataLen + 9 + dataLen * sizeof(T));
 		bb.Write(dataLen);
 		if (!dataLen) return;
-		if constexpr(sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>>)
-		{
-			memcpy(bb.buf + bb.dataLen, buf, dataLen * sizeof(T));
-			bb.dataLen += dataLen * sizeof(T);
-		}
-		else
+
+		// 1 字节元素 与 float 一直是原始字节. 其他可打包的元素 标记了才打包
+		if constexpr(IsPackable_v<T>)
 		{
-			for (size_t i = 0; i < dataLen; ++i)
+			if (sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>> || packed)
 			{
-				bb.Write(At(i));
+				memcpy(bb.buf + bb.dataLen, buf, dataLen * sizeof(T));
+				bb.dataLen += dataLen * sizeof(T);
+				return;
 			}
 		}
+		for (size_t i = 0; i < dataLen; ++i)
+		{
+			bb.Write(At(i));
+		}
 	}
 
 	template<typename T>
 	int List<T>::FromBBuffer(BBuffer& bb) noexcept
 	{
+		auto packed = bb.packedList;
+		bb.packedList = false;
+
 		size_t len = 0;
 		if (auto rtv = bb.Read(len)) return rtv;
 		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
 		if (bb.offset + len > bb.dataLen) return -2;
+		if constexpr(IsPackable_v<T>)
+		{
+			if (sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>> || packed)
+			{
+				if (len > (bb.dataLen - bb.offset) / sizeof(T)) return -2;
+				if (TryReserve(len)) return -3;					// 超出内存预算
+				Resize(len);
+				memcpy(buf, bb.buf + bb.offset, len * sizeof(T));
+				bb.offset += len * sizeof(T);
+				return 0;
+			}
+		}
+		if (TryReserve(len)) return -3;
 		Resize(len);
-		if (len == 0) return 0;
-		if constexpr(sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>>)
+		for (size_t i = 0; i < len; ++i)
 		{
-			memcpy(buf, bb.buf + bb.offset, len * sizeof(T));
-			bb.offset += len * sizeof(T);
-			dataLen = len;
+			if (auto rtv = bb.Read(At(i)))
+			{
+				Clear(true);
+				return rtv;
+			}
 		}
-		else
+		return 0;
+	}
+
+	template<typename T>
+	void List<T>::CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept
+	{
+		auto packed = bb.packedList;
+		bb.packedList = false;
+
+		len += VarLen7(dataLen);
+		if constexpr(IsPackable_v<T>)
 		{
-			for (size_t i = 0; i < len; ++i)
+			if (sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>> || packed)
 			{
-				if (auto rtv = bb.Read(At(i)))
+				len += dataLen * sizeof(T);
+				return;
+			}
+		}
+		for (size_t i = 0; i < dataLen; ++i)
+		{
+			BytesFunc<T>::CalcLen(bb, At(i), len);
+		}
+	}
+
+	template<typename T>
+	int List<T>::SkipBBuffer(BBuffer& bb) noexcept
+	{
+		auto packed = bb.packedList;
+		bb.packedList = false;
+
+		size_t len = 0;
+		if (auto rtv = bb.Read(len)) return rtv;
+		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+		if (bb.offset + len > bb.dataLen) return -2;
+		if constexpr(IsPackable_v<T>)
+		{
+			if (sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>> || packed)
+			{
+				if (len > (bb.dataLen - bb.offset) / sizeof(T)) return -2;
+				bb.offset += len * sizeof(T);
+				return 0;
+			}
+		}
+		for (size_t i = 0; i < len; ++i)
+		{
+			if (auto rtv = BytesFunc<T>::Skip(bb)) return rtv;
+		}
+		return 0;
+	}
+
+	template<typename T>
+	int List<T>::WriteJson(BBuffer& bb, String& s) noexcept
+	{
+		auto packed = bb.packedList;
+		bb.packedList = false;
+
+		size_t len = 0;
+		if (auto rtv = bb.Read(len)) return rtv;
+		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+		if (bb.offset + len > bb.dataLen) return -2;
+		s.Append('[');
+		if constexpr(IsPackable_v<T>)
+		{
+			if (sizeof(T) == 1 || std::is_same_v<float, std::decay_t<T>> || packed)
+			{
+				if (len > (bb.dataLen - bb.offset) / sizeof(T)) return -2;
+				for (size_t i = 0; i < len; ++i)
 				{
-					Clear(true);
-					return rtv;
+					T v;
+					memcpy(&v, bb.buf + bb.offset + i * sizeof(T), sizeof(T));
+					if (i) s.Append(',');
+					if constexpr (std::is_same_v<T, bool>) s.Append(v ? "true" : "false");
+					else if constexpr (std::is_floating_point_v<T>) JsonAppendNumber(s, v);
+					else if constexpr (sizeof(T) == 1) s.Append((int)v);
+					else s.Append(v);
 				}
+				bb.offset += len * sizeof(T);
+				s.Append(']');
+				return 0;
 			}
 		}
+		for (size_t i = 0; i < len; ++i)
+		{
+			if (i) s.Append(',');
+			if (auto rtv = JsonFunc<T>::WriteTo(bb, s)) return rtv;
+		}
+		s.Append(']');
 		return 0;
 	}
 
@@ -42,6 +42,20 @@ namespace xx
 		{}
 		Log(Log const&) = delete;
 		Log& operator=(Log const&) = delete;
+
+		// 供 ObjectPool 复用: 清空各字段( 保留 String 已分配的内存 )
+		void Reset() noexcept
+		{
+			id = 0;
+			level = (LogLevel)0;
+			time = 0;
+			machine.Clear();
+			service.Clear();
+			instanceId.Clear();
+			title.Clear();
+			opcode = 0;
+			desc.Clear();
+		}
 	};
 	using Log_p = Ptr<Log>;
 
@@ -88,6 +102,10 @@ int main(int argc, char const* const* argv)
 		MemPool mp2;
 		Queue<Log_p> logs2;					// 切换使用
 
+		// 每个 mp 配一个 Log 对象池. 后台 Pop 掉的 Log 回收后供前台复用, 免去反复构造 String
+		ObjectPool<Log> logPool1;
+		ObjectPool<Log> logPool2;
+
 		Queue<Log_p>* logs;					// 指向当前正在使用的 logs
 		Queue<Log_p>* bgLogs;				// 指向后台 logs
 		std::mutex mtx;
@@ -110,6 +128,8 @@ int main(int argc, char const* const* argv)
 			, instanceId(&mp, nameLenLimit)
 			, logs1(&mp1)
 			, logs2(&mp2)
+			, logPool1(&mp1)
+			, logPool2(&mp2)
 			, logs(&logs1)
 			, bgLogs(&logs2)
 			, limit(limit)
@@ -201,6 +221,12 @@ values (?, ?, ?, ?, ?, ?, ?, ?))=-=");
 		}
 
 
+		// 从当前队列所属 mp 的对象池中拿一个 Log
+		Log_p TakeLog() noexcept
+		{
+			return (logs == &logs1 ? logPool1 : logPool2).TakePtr();
+		}
+
 		// 向 db 插入一条 log. time 传入 NowEpoch10m
 		template<typename MachineType, typename ServiceType, typename InstanceIdType, typename TitleType, typename DescType>
 		inline void InsertLog
@@ -230,7 +256,7 @@ values (?, ?, ?, ?, ?, ?, ?, ?))=-=");
 			std::lock_guard<std::mutex> lg(mtx);
 			if (limit && logs->Count() > limit) return false;
 
-			auto o = logs->mempool->MPCreatePtr<Log>();
+			auto o = TakeLog();
 
 			o->id = 2;             // 用来标记是通过 WaitAll 写入的
 			o->level = level;
@@ -253,7 +279,7 @@ values (?, ?, ?, ?, ?, ?, ?, ?))=-=");
 			std::lock_guard<std::mutex> lg(mtx);
 			if (limit && logs->Count() > limit) return false;
 
-			auto o = logs->mempool->MPCreatePtr<Log>();
+			auto o = TakeLog();
 
 			o->id = 0;				// 用来标记是通过 SetDefaultValue 写入的
 			o->machine.Assign(machine);
@@ -272,7 +298,7 @@ values (?, ?, ?, ?, ?, ?, ?, ?))=-=");
 			std::lock_guard<std::mutex> lg(mtx);
 			if (limit && logs->Count() > limit) return false;
 
-			auto o = logs->mempool->MPCreatePtr<Log>();
+			auto o = TakeLog();
 
 			o->id = 1;             // 用来标记是通过 Write 写入的
 			o->level = level;
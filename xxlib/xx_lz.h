@@ -0,0 +1,19 @@
+﻿#pragma once
+namespace xx
+{
+	/**************************************************************************************************/
+	// LZ 压缩 / 解压( LZ4 block 格式, 无外部依赖. 供收发包压缩用 )
+	/**************************************************************************************************/
+
+	// 压缩用 hash 表的位数( 表长 = 1 << LzHashLog 个 uint32_t )
+	static const int LzHashLog = 12;
+
+	// 返回 len 字节数据压缩后的最大可能长度( 压缩目标区需留足这么多 )
+	size_t LzBound(size_t const& len) noexcept;
+
+	// 压缩 src 到 dst( 至少 LzBound(len) 字节 ). hashs 为 1 << LzHashLog 个 uint32_t 的工作区, 可反复使用, 不需清零. 返回压缩后长度
+	size_t LzCompress(char const* const& src, size_t const& len, char* const& dst, uint32_t* const& hashs) noexcept;
+
+	// 解压 src 到 dst. 解压后长度须正好为 dstLen( 由调用方另行传递 ). 数据有误( 越界, 长度不符 )返回非 0
+	int LzDecompress(char const* const& src, size_t const& len, char* const& dst, size_t const& dstLen) noexcept;
+}
@@ -0,0 +1,149 @@
+﻿#pragma once
+namespace xx
+{
+	inline size_t LzBound(size_t const& len) noexcept
+	{
+		return len + len / 255 + 16;
+	}
+
+	// 写 15 起的延长长度( 255 255 .. 余数 )
+	inline void LzWriteLength(uint8_t*& op, size_t len) noexcept
+	{
+		while (len >= 255)
+		{
+			*op++ = 255;
+			len -= 255;
+		}
+		*op++ = (uint8_t)len;
+	}
+
+	inline size_t LzCompress(char const* const& src, size_t const& len, char* const& dst, uint32_t* const& hashs) noexcept
+	{
+		auto s = (uint8_t const*)src;
+		auto op = (uint8_t*)dst;
+		size_t ip = 0, anchor = 0;
+
+		// 格式要求: 最后 5 字节必为字面量, 最后一个匹配须开始于末尾 12 字节之前
+		if (len >= 13)
+		{
+			auto ipLimit = len - 12;
+			auto matchLimit = len - 5;
+			while (ip < ipLimit)
+			{
+				uint32_t seq;
+				memcpy(&seq, s + ip, 4);
+				auto h = (seq * 2654435761u) >> (32 - LzHashLog);
+				size_t ref = hashs[h];
+				hashs[h] = (uint32_t)ip;
+
+				// 表中可能残留上次压缩的值, 故须校验 位置在前, 距离在 64k 内, 内容相同
+				uint32_t refSeq;
+				if (ref >= ip || ip - ref > 65535 || (memcpy(&refSeq, s + ref, 4), refSeq != seq))
+				{
+					ip += 1 + ((ip - anchor) >> 6);		// 连续找不到匹配时 加大步长
+					continue;
+				}
+
+				// 匹配向前扩展
+				while (ip > anchor && ref > 0 && s[ip - 1] == s[ref - 1])
+				{
+					--ip;
+					--ref;
+				}
+
+				// 匹配向后扩展
+				size_t mLen = 4;
+				while (ip + mLen < matchLimit && s[ref + mLen] == s[ip + mLen]) ++mLen;
+
+				// token + 字面量长 + 字面量 + 距离 + 匹配长
+				auto litLen = ip - anchor;
+				auto token = op++;
+				*token = (uint8_t)(((litLen < 15 ? litLen : 15) << 4) | (mLen - 4 < 15 ? mLen - 4 : 15));
+				if (litLen >= 15) LzWriteLength(op, litLen - 15);
+				memcpy(op, s + anchor, litLen);
+				op += litLen;
+				auto dist = ip - ref;
+				op[0] = (uint8_t)dist;
+				op[1] = (uint8_t)(dist >> 8);
+				op += 2;
+				if (mLen - 4 >= 15) LzWriteLength(op, mLen - 4 - 15);
+
+				ip += mLen;
+				anchor = ip;
+			}
+		}
+
+		// 剩余字面量
+		auto litLen = len - anchor;
+		*op++ = (uint8_t)((litLen < 15 ? litLen : 15) << 4);
+		if (litLen >= 15) LzWriteLength(op, litLen - 15);
+		memcpy(op, s + anchor, litLen);
+		op += litLen;
+		return op - (uint8_t*)dst;
+	}
+
+	inline int LzDecompress(char const* const& src, size_t const& len, char* const& dst, size_t const& dstLen) noexcept
+	{
+		auto s = (uint8_t const*)src;
+		auto d = (uint8_t*)dst;
+		size_t ip = 0, op = 0;
+		while (true)
+		{
+			if (ip >= len) return -1;
+			auto token = s[ip++];
+
+			size_t litLen = token >> 4;
+			if (litLen == 15)
+			{
+				uint8_t b;
+				do
+				{
+					if (ip >= len) return -2;
+					b = s[ip++];
+					litLen += b;
+					if (litLen > dstLen) return -3;
+				} while (b == 255);
+			}
+			if (litLen > len - ip || litLen > dstLen - op) return -4;
+			memcpy(d + op, s + ip, litLen);
+			ip += litLen;
+			op += litLen;
+
+			// 最后一段只有字面量
+			if (ip == len) break;
+
+			if (len - ip < 2) return -5;
+			size_t dist = s[ip] | (s[ip + 1] << 8);
+			ip += 2;
+			if (!dist || dist > op) return -6;
+
+			size_t mLen = token & 15;
+			if (mLen == 15)
+			{
+				uint8_t b;
+				do
+				{
+					if (ip >= len) return -7;
+					b = s[ip++];
+					mLen += b;
+					if (mLen > dstLen) return -8;
+				} while (b == 255);
+			}
+			mLen += 4;
+			if (mLen > dstLen - op) return -9;
+
+			// 距离小于匹配长时 源与目标重叠, 须逐字节复制
+			auto p = d + op - dist;
+			if (dist >= mLen)
+			{
+				memcpy(d + op, p, mLen);
+			}
+			else
+			{
+				for (size_t i = 0; i < mLen; ++i) d[op + i] = p[i];
+			}
+			op += mLen;
+		}
+		return op == dstLen ? 0 : -10;
+	}
+}
@@ -50,6 +50,16 @@ namespace xx
 	template<typename T>
 	constexpr uint16_t TypeId_v = TypeId<T>::value;
 
+	// 树形类型标记( 生成器为模板中标记了 Tree 的类 及其 List 特化 ). 对象图无共享 / 循环引用, 序列化时不经 ptrStore / idxStore, 也不写 offset
+	template<typename T>
+	struct IsTree
+	{
+		static const bool value = false;
+	};
+
+	template<typename T>
+	constexpr bool IsTree_v = IsTree<T>::value;
+
 
 	// 一些预声明
 
@@ -75,20 +85,254 @@ namespace xx
 
 
 	/***********************************************************************************/
-	// 粗暴快速的非线程安全内存池
+	// 代数句柄. 指向 MemPool 句柄表中的槽位, 槽位的 generation 与之不符即失效. 校验不访问对象内存
+	/***********************************************************************************/
+
+	template<typename T>
+	struct Handle
+	{
+		uint32_t index = 0;			// 槽位下标. 0 号槽不用, 故 0 表示空句柄
+		uint32_t generation = 0;
+
+		Handle() noexcept = default;
+		Handle(uint32_t const& index, uint32_t const& generation) noexcept;
+
+		// 派生类句柄可隐式转为基类句柄
+		template<typename O>
+		Handle(Handle<O> const& o) noexcept;
+
+		operator bool() const noexcept;
+		bool operator==(Handle const& o) const noexcept;
+		bool operator!=(Handle const& o) const noexcept;
+	};
+
+
+	/***********************************************************************************/
+	// 顺序分配器. 可记录位置并整体回卷. MemPool 可临时将 Alloc / Create 转到这里
+	/***********************************************************************************/
+
+	// 分配出来的内存块 内存头 mpIndex 为 0, 其前方存有数据区长度. Free / Release 不回收, 靠 Rewind 整体回收
+	class MemArena
+	{
+	public:
+		// 内存段( 数据区紧随其后 )
+		struct Chunk
+		{
+			Chunk* next;
+			size_t len;
+		};
+
+		// 用于回卷的位置
+		struct Mark
+		{
+			Chunk* chunk = nullptr;
+			char* cursor = nullptr;
+		};
+
+		// 默认内存段长度
+		static const size_t chunkSize = 64 * 1024;
+
+	protected:
+		Chunk* head = nullptr;		// 第一个内存段
+		Chunk* cur = nullptr;		// 当前内存段( 后面的内存段回卷后留着复用 )
+		char* cursor = nullptr;		// 当前分配位置
+		char* end = nullptr;		// 当前内存段结束位置
+
+	public:
+		MemArena() noexcept = default;
+		~MemArena() noexcept;
+		MemArena(MemArena const&) = delete;
+		MemArena& operator=(MemArena const&) = delete;
+
+		// 分配 长度前缀 + 长为 headerSiz 的内存头 + 长为 siz 的数据区, 返回内存头地址( 数据区 16 字节对齐 )
+		void* Alloc(size_t const& siz, size_t const& headerSiz) noexcept;
+
+		// 记录当前位置
+		Mark GetMark() const noexcept;
+
+		// 回卷到 m 处. 其后分配的内存全部作废( 不执行析构 )
+		void Rewind(Mark const& m) noexcept;
+
+		// 回卷到起点
+		void Reset() noexcept;
+	};
+
+
+	/***********************************************************************************/
+	// 内存池统计( 编译前将 XX_MEMPOOL_STATS 定义为 0 可去掉所有计数代码 )
+	/***********************************************************************************/
+
+#ifndef XX_MEMPOOL_STATS
+#define XX_MEMPOOL_STATS 1
+#endif
+
+	struct MemPoolStats
+	{
+		// 某尺寸档位的计数
+		struct Item
+		{
+			uint64_t allocs;		// Alloc 调用次数
+			uint64_t hits;			// 从链表拿到的次数
+			uint64_t misses;		// 链表为空从 slab 切分的次数
+			uint64_t lives;			// 正在使用的块数
+			uint64_t caches;		// 链表中缓存的空闲块数
+			uint64_t peakLives;		// 正在使用的块数 峰值
+		};
+
+		// 下标即 mpIndex
+		std::array<Item, sizeof(void*) * 8 * 4> items;
+
+		size_t liveBytes;			// 正在使用的内存块总字节数
+		size_t peakBytes;			// 正在使用的内存块总字节数 峰值
+		size_t residentBytes;		// 占用的物理内存字节数
+
+		uint64_t largeAllocs;		// 大块内存 Alloc 次数( 直接向系统申请, 不进链表 )
+		uint64_t largeLives;		// 正在使用的大块内存块数
+		size_t largeBytes;			// 正在使用的大块内存字节数
+
+		// 输出为 json( 只含用到过的档位 ). 可直接用于 UvHttpPeer::SendHttpResponse
+		void ToString(String& s) const noexcept;
+
+		// 从 ToString 输出的 json 中读回各档位的计数( 用于存盘后在启动时 Prewarm ). 成功返回 0
+		int FromString(char const* const& in) noexcept;
+	};
+
+
+	/***********************************************************************************/
+	// 粗暴快速的非线程安全内存池( 可开启跨线程归还模式 )
 	/***********************************************************************************/
 
 	class MemPool
 	{
 		static_assert(sizeof(size_t) <= sizeof(void*));
 
-		// 数组长度涵盖所有 2^n 对齐分配长度规则
-		std::array<void*, sizeof(void*) * 8> headers;
+		// 数组长度涵盖所有尺寸档位( 每个 2^n 区间再 4 等分, 下标 = n * 4 + 等分序号, 64 字节以下只有 2^n 档 )
+		std::array<void*, sizeof(void*) * 8 * 4> headers;
 
 		// 循环自增版本号( 每次创建时先 ++ 再填充 )
 		decltype(MemHeader::versionNumber) versionNumber = 0;
 
+		// 跨线程归还链表( 多生产者单消费者. 非 owner 线程 Free / Release 的内存块压入这里, owner 线程 Alloc 时回收 )
+		std::atomic<void*> returns;
+
+		// 开启跨线程归还后记录的 owner 线程
+		std::thread::id ownerThreadId;
+
+		// 是否已开启跨线程归还
+		bool crossThread = false;
+
+		// 非 owner 线程归还内存块( 用块内 [0] 存 next, [8] 存链表下标 )
+		void PushReturn(void* const& h, size_t const& idx) noexcept;
+
+		// 退回的是对象时 下标带上此标记, 以便 owner 回收时作废其句柄( 句柄表只在 owner 线程读写 )
+		static constexpr size_t returnObjectFlag = (size_t)1 << (sizeof(size_t) * 8 - 1);
+
+
+		// 向系统申请的整块内存. 小块切分后填充链表, 大块一块一用. 按地址排序存放, 便于 Trim 时二分定位
+		struct Slab
+		{
+			char* ptr;
+			size_t len;
+			size_t idx;				// 所属链表下标
+			bool trimmed;			// 已归还物理内存( 地址保留, 仅供同下标复用 )
+		};
+		Slab* slabs = nullptr;
+		size_t slabsLen = 0;
+		size_t slabsCap = 0;
+
+		// 各链表下标 已 Trim 可复用的 slab 个数
+		std::array<uint32_t, sizeof(void*) * 8 * 4> trimmedCounts;
+
+		// 当前占用的物理内存字节数( 不含已 Trim 的 slab )
+		size_t residentBytes = 0;
+
+#if XX_MEMPOOL_STATS
+		// 统计数据
+		MemPoolStats stats;
+#endif
+
+		// 链表为空时从 slab 切出一批内存块, 返回其中一块
+		void* Refill(size_t const& idx) noexcept;
+
+		// 向系统申请长为 len 的 slab 并登记( 按地址顺序插入 )
+		char* AddSlab(size_t const& idx, size_t const& len) noexcept;
+
+		// 确保下标为 idx 的链表中至少有 count 个空闲块. 返回新切出的块数
+		size_t PrewarmIndex(size_t const& idx, size_t const& count) noexcept;
+
+		// 二分查找 p 所在 slab 的下标
+		size_t FindSlab(void* const& p) const noexcept;
+
+		// 内存块回到链表时的计数( usedBytes 总是要算 )
+		void StatFree(size_t const& idx) noexcept;
+
+		// 正在使用的字节数( 内存池块 + 大块内存, 不含 arena ). 用于内存预算
+		size_t usedBytes = 0;
+
+		// 已超过 softLimit 且已触发过 OnSoftLimit
+		bool softLimitReached = false;
+
+		// 分配前检查内存预算. 超过 hardLimit 返回非 0
+		int CheckBudget(size_t const& siz) noexcept;
+
+		// 对象池回收器( 按虚表指针匹配类型, 派生类不算 )
+		struct Recycler
+		{
+			void* vptr;
+			void* pool;
+			bool(*func)(void* const& pool, Object* const& o) noexcept;
+		};
+		std::array<Recycler, 8> recyclers;
+		size_t recyclersLen = 0;
+
+		// 句柄表槽位. 空闲槽位用 nextFree 串成链表( 0 表示链表尾 )
+		struct HandleSlot
+		{
+			Object* pointer;
+			uint32_t generation;
+			uint32_t nextFree;
+			decltype(MemHeader::versionNumber) versionNumber;	// 跨线程模式下 Get 据此判断对象是否已被别的线程释放
+		};
+		HandleSlot* handleSlots = nullptr;
+		uint32_t handleSlotsLen = 0;
+		uint32_t handleSlotsCap = 0;
+		uint32_t handleFreeHead = 0;
+		uint32_t handlesCount = 0;
+
+		// 对象 -> 槽位下标. Release 时据此作废句柄( 首次 MakeHandle 时创建 )
+		Dict<void*, uint32_t>* handleIndexs = nullptr;
+
+		// 作废 p 的句柄并回收槽位
+		void ReleaseHandle(Object* const& p) noexcept;
+
+		// 延迟析构队列( 后进先出, 令子对象紧随父对象析构 ). idx 为入队前从内存头取出的链表下标
+		struct DeferredRelease
+		{
+			Object* pointer;
+			size_t idx;
+		};
+		DeferredRelease* deferreds = nullptr;
+		size_t deferredsLen = 0;
+		size_t deferredsCap = 0;
+
+		// 入队. 扩容失败返回 false( 此时应立即析构 )
+		bool PushDeferred(Object* const& p, size_t const& idx) noexcept;
+
+		// 执行析构并归还内存块( Release 的后半段. 版本号已置 0 )
+		void Destroy(Object* const& p, size_t const& idx) noexcept;
+
+		// 大块内存: 页首存映射长度, 内存头紧随其后( 数据区 16 字节对齐 ). 内存头 mpIndex 为 1
+		void* AllocLarge(size_t const& siz) noexcept;
+		void FreeLarge(void* const& h) noexcept;
+#ifdef __linux__
+		void* ReallocLarge(void* const& h, size_t const& newSize) noexcept;
+#endif
+
 	public:
+		// 小于等于 slabSize / 4 的内存块 从 slabSize 长的 slab 中切分. 更大的一块一个 slab( 按 pageSize 对齐 )
+		static const size_t slabSize = 64 * 1024;
+		static const size_t pageSize = 4096;
+
 		MemPool() noexcept;
 		~MemPool() noexcept;
 		MemPool(MemPool const&) = delete;
@@ -100,7 +344,7 @@ namespace xx
 		template<typename MHType = MemHeader>
 		void Free(void* const& p) noexcept;
 
-		// 可用于创建 lua state
+		// 可用于创建 lua state. 大块内存在 linux 下用 mremap 原地扩容或换址, 不 memcpy
 		void* Realloc(void* const& p, size_t const& newSize, size_t const& dataLen = -1) noexcept;
 
 		// 正常 create 系列
@@ -146,6 +390,139 @@ namespace xx
 
 		void Release(Object* const& o) noexcept;
 
+
+		// 含内存头长度超过此值的 非对象 内存块 直接向系统申请页内存, Free 时立即归还( 不缓存于链表 )
+		size_t largeThreshold = 1024 * 1024;
+
+
+		/***********************************************************************************/
+		// 内存预算相关( 按正在使用的字节数计. 0 表示不限 )
+
+		// 分配使得用量超过此值时 触发 OnSoftLimit( 用量降回以下后再超过 可再次触发 )
+		size_t softLimit = 0;
+
+		// 分配使得用量超过此值时 Alloc / Create 返回空, 并触发 OnHardLimit.
+		// List::Reserve 等 不检查结果就写入的扩容 此时将 abort, 能应对失败的地方应使用 TryReserve. 反序列化返回错误, BBuffer 写入置 overBudget( Send 系列据此失败返回 )
+		size_t hardLimit = 0;
+
+		// 在 Alloc 中触发( 调用方可能正处于 uv 回调等不可重入的上下文 ), 宜只做标记, 减负操作另找时机执行( 例如 UvLoop 在 uv check 中暂停读取部分连接 )
+		std::function<void()> OnSoftLimit;
+
+		// 在 Alloc 中触发. 参数为本次申请的字节数
+		std::function<void(size_t)> OnHardLimit;
+
+		// 返回正在使用的字节数
+		size_t GetUsedBytes() const noexcept;
+
+
+		/***********************************************************************************/
+		// 预热相关( 在启动时把内存块准备好, 免得首波分配时才去切 slab. 新切的块地址连续, 按地址递增顺序分配出去 )
+
+		// 确保 Alloc(siz) 对应的链表中至少有 count 个空闲块. 返回新切出的块数
+		size_t Prewarm(size_t const& siz, size_t const& count) noexcept;
+
+		// 确保 Create<T> 对应的链表中至少有 count 个空闲块. 返回新切出的块数
+		template<typename T>
+		size_t Prewarm(size_t const& count) noexcept;
+
+		// 按统计数据中各档位的 peakLives 预热( 可用 Snapshot() 或 MemPoolStats::FromString 得到 ). 只处理 [MinIndex(), largeThreshold] 间的档位. 返回新切出的块数
+		size_t Prewarm(MemPoolStats const& s) noexcept;
+
+
+		/***********************************************************************************/
+		// 对象池相关( 一般由 ObjectPool 调用 )
+
+		// 注册回收器: Release 虚表指针为 vptr 的对象时 依次交给各 func, 返回 true 表示已回收( 不析构, 不归还内存 ), 都返回 false 则析构. arena 中的对象不交给 func. 已满返回 false
+		bool AddRecycler(void* const& vptr, void* const& pool, bool(*func)(void* const& pool, Object* const& o) noexcept) noexcept;
+
+		// 移除 pool 注册的回收器
+		void RemoveRecycler(void* const& pool) noexcept;
+
+
+		/***********************************************************************************/
+		// 延迟析构相关( 避免 Release 大对象图时长时间卡顿. 非线程安全, 只在 owner 线程入队 )
+
+		// 为 true 时 Release 令对象立即失效( 版本号置 0, 句柄作废 ), 但析构推迟到 ReleaseDeferred / Flush 中分片执行.
+		// 析构过程中释放的子对象同样入队. arena 中的对象, 非 owner 线程的 Release, Deferrable() 返回 false 的对象( uv 相关类 ) 不延迟
+		bool deferRelease = false;
+
+		// 在约 microseconds 微秒内 析构队列中的对象. 返回析构的个数
+		size_t ReleaseDeferred(uint64_t const& microseconds) noexcept;
+
+		// 析构队列中的所有对象( 含析构过程中新入队的 ). 退出前应调用. 返回析构的个数
+		size_t Flush() noexcept;
+
+		// 返回队列中等待析构的对象个数
+		size_t GetDeferredCount() const noexcept;
+
+
+		/***********************************************************************************/
+		// 句柄表相关( 替代 Weak 的另一种弱引用. 句柄只有 8 字节, 校验只读句柄表. 非线程安全, 只能在 owner 线程使用 )
+
+		// 为 p 分配句柄( 同一对象多次调用返回同一句柄 ). p 被 Release( 含被对象池回收 ) 后句柄失效. 失败返回空句柄
+		template<typename T>
+		Handle<T> MakeHandle(T* const& p) noexcept;
+
+		template<typename T>
+		Handle<T> MakeHandle(Ptr<T> const& p) noexcept;
+
+		// 句柄有效返回对象指针, 否则返回空. 非 owner 线程 Release 的对象 在 owner 回收( CollectReturns )时作废句柄, 此前 Get 也返回空
+		template<typename T>
+		T* Get(Handle<T> const& h) const noexcept;
+
+		// 句柄有效返回对象的 Ptr, 否则返回空
+		template<typename T>
+		Ptr<T> GetPtr(Handle<T> const& h) const noexcept;
+
+		// 返回有效句柄个数
+		size_t GetHandlesCount() const noexcept;
+
+
+		/***********************************************************************************/
+		// arena 相关
+
+		// 非空时 Alloc / Create 将从这里分配. 通常配合 MemArenaScope 或 BBuffer::arena 使用
+		MemArena* arena = nullptr;
+
+		// 判断内存块 / 对象是否分配自 arena
+		static bool IsArenaMemory(void* const& p) noexcept;
+		static bool IsArenaMemory(Object* const& p) noexcept;
+
+		// 如果 o 分配自 arena, 通过序列化将整个对象图复制到内存池, 令其在 arena 回卷后依旧有效. 成功返回 0
+		template<typename T>
+		int Promote(Ptr<T>& o) noexcept;
+
+
+		/***********************************************************************************/
+		// 跨线程相关( 每个线程用自己的 MemPool 分配. 别的线程分配的对象可以交给本线程使用并最终在本线程释放 )
+
+		// 以当前线程为 owner 开启跨线程归还. 之后只有 owner 线程可 Alloc / Create, 其他线程的 Free / Release 将无锁退回 owner
+		void InitCrossThreadFree() noexcept;
+
+		// 回收别的线程退回的内存块到链表( owner 线程 Alloc 时会自动调用 )
+		void CollectReturns() noexcept;
+
+
+		/***********************************************************************************/
+		// 内存收缩相关( 完全空闲的 slab 将物理内存还给系统, 地址保留, 故 Weak / Ref 的版本号检测依旧安全 )
+
+		// 归还所有完全空闲的 slab. 返回归还的字节数
+		size_t Trim() noexcept;
+
+		// 归还完全空闲的 slab 直到 占用字节数 <= bytes( 或已无可归还 ). 返回归还的字节数
+		size_t ShrinkTo(size_t const& bytes) noexcept;
+
+		// 返回当前占用的物理内存字节数
+		size_t GetResidentBytes() const noexcept;
+
+		// 返回统计数据的副本( XX_MEMPOOL_STATS 为 0 时 仅 liveBytes, residentBytes 有值 )
+		MemPoolStats Snapshot() const noexcept;
+
+		// 页内存分配( mmap / VirtualAlloc ), 归还( munmap / VirtualFree ), 丢弃物理页但保留地址( 再读到的是 0 或旧的空闲数据 )
+		static void* PageAlloc(size_t const& siz) noexcept;
+		static void PageFree(void* const& p, size_t const& siz) noexcept;
+		static void PageDiscard(void* const& p, size_t const& siz) noexcept;
+
 		/***********************************************************************************/
 		// 工具函数
 
@@ -154,6 +531,18 @@ namespace xx
 		// 将长度值按 2^n 来对齐
 		static size_t Round2n(size_t const& n) noexcept;
 
+		// 根据 含内存头的长度 算出 尺寸档位下标( 即 mpIndex )
+		static size_t CalcIndex(size_t const& n) noexcept;
+
+		// 根据 尺寸档位下标 得到 内存块长度. idx 不可小于 MinIndex()
+		static size_t IndexToSize(size_t const& idx) noexcept;
+
+		// 实际用到的最小尺寸档位下标( 只含内存头的块 ). 更小的下标不对应任何档位
+		static size_t MinIndex() noexcept;
+
+		// 将 含内存头的长度 按尺寸档位对齐( List 等容器用它来充分利用分配到的空间 )
+		static size_t RoundSize(size_t const& n) noexcept;
+
 
 		/***********************************************************************************/
 		// typeId & 序列化 相关
@@ -166,15 +555,43 @@ namespace xx
 		// 存 typeId 到序列化构造函数的映射
 		inline static std::array<Creator, 1 << (sizeof(uint16_t) * 8)> creators;
 
+		typedef int(*Skipper)(BBuffer&);
+
+		// 存 typeId 到 跳过该类型序列化数据 的函数的映射( 即 T::SkipBBuffer. 供 BBuffer::SkipPtr 按实际类型跳过 )
+		inline static std::array<Skipper, 1 << (sizeof(uint16_t) * 8)> skippers;
+
+		typedef int(*Jsoner)(BBuffer&, String&);
+
+		// 存 typeId 到 将该类型序列化数据直接转为 json 的函数的映射( 即 T::WriteJson. 供 BBuffer::PtrToJson 按实际类型转换 )
+		inline static std::array<Jsoner, 1 << (sizeof(uint16_t) * 8)> jsoners;
+
+		// 存 typeId 是否为树形类型( 即 IsTree_v<T>. 实际类型可能是指针声明类型的派生类, 故读写时按 typeId 查 )
+		inline static std::array<bool, 1 << (sizeof(uint16_t) * 8)> trees;
+
 		// 注册 String, BBuffer 的 typeId 映射( 需要在程序最开始时执行 )
 		static void RegisterInternals() noexcept;
 
-		// 注册类型的父子关系. 顺便生成创建函数. Object 不需要注册. T 需要提供相应构造函数 for 反序列化
+		// 注册类型的父子关系. 顺便生成创建函数. Object 不需要注册. T 需要提供相应构造函数 for 反序列化, 以及 static SkipBBuffer, WriteJson( 未提供则继承自父类, 只能处理父类部分 )
 		template<typename T, typename PT>
 		static void Register() noexcept;
 
+		// 因父类尚未注册而暂未生成祖先表的类型个数( 生成代码中 子类 可能先于 父类 注册 )
+		inline static size_t ancestryPendings = 0;
+
+		// 沿 pids 生成 typeId 的 深度 & 祖先表. 链上有未注册的父类时返回 false( 待父类注册后重建 )
+		static bool BuildAncestry(uint16_t const& typeId) noexcept;
+
+
+		// 继承链预计算的最大深度( 超过的类型 IsBaseOf 退化为沿 pids 逐级回溯 )
+		static const size_t maxTypeDepth = 8;
+
+		// 类型在继承树中的深度. Object 为 0, 直接继承 Object 的为 1. 0 也表示 未注册 / 父未注册 / 超深
+		inline static std::array<uint8_t, 1 << (sizeof(uint16_t) * 8)> typeDepths;
 
-		// 根据 typeid 判断父子关系
+		// 类型的祖先表: [d - 1] 为深度 d 处的祖先 typeId( [depth - 1] 即自己 ). 令 IsBaseOf 只需一次下标比较
+		inline static std::array<std::array<uint16_t, maxTypeDepth>, 1 << (sizeof(uint16_t) * 8)> typeAncestors;
+
+		// 根据 typeid 判断父子关系( 祖先表就绪时 O(1) )
 		static bool IsBaseOf(uint32_t const& baseTypeId, uint32_t typeId) noexcept;
 
 		// 根据 类型 判断父子关系
@@ -192,6 +609,7 @@ namespace xx
 		// BBuffer 序列化 & 反序列化时会用到
 		Dict<void*, size_t>* ptrStore;
 		Dict<size_t, std::pair<void*, uint16_t>>* idxStore;
+		Dict<String*, size_t>* strStore;			// 按内容合并 String( 见 BBuffer::dedupStrings )
 
 		// 域名解析去重会用到
 		HashSet<xx::Ptr<xx::String>>* strs;
@@ -200,6 +618,69 @@ namespace xx
 
 
 
+	/***********************************************************************************/
+	// 令 mp 在作用域内从 arena 分配. 离开作用域时恢复, 并将 arena 回卷到进入时的位置
+	/***********************************************************************************/
+
+	struct MemArenaScope
+	{
+		MemPool& mp;
+		MemArena& arena;
+		MemArena* bak;
+		MemArena::Mark mark;
+
+		MemArenaScope(MemPool& mp, MemArena& arena) noexcept;
+		~MemArenaScope() noexcept;
+		MemArenaScope(MemArenaScope const&) = delete;
+		MemArenaScope& operator=(MemArenaScope const&) = delete;
+	};
+
+
+	/***********************************************************************************/
+	// 类型对象池. Release 时不析构, 调 Reset() 清理后缓存( 保留已扩容的容器内存 ), Take 时复用
+	/***********************************************************************************/
+
+	// T 需提供 void Reset() noexcept. Take 带参时, 复用的对象将调用 int Init(args...) noexcept 重新初始化( 参数同构造函数, 不含 MemPool* )
+	// 被回收的对象 版本号会更新, 故 Weak / Ref 将失效. 需先于 mempool 析构
+	template<typename T>
+	class ObjectPool
+	{
+	public:
+		MemPool* mempool;
+		size_t limit;				// 缓存上限. 0 表示不缓存( 相当于直接 Create )
+
+		// 同类型有多个池子时( 回收器按虚表指针匹配, 分不出 ), 用它判断 o 是否归本池. 返回 false 则交给下一个同类型池子, 都不收就析构. 空: 都收
+		bool(*owns)(ObjectPool<T> const& pool, T* const& o) noexcept = nullptr;
+
+	protected:
+		T** objs = nullptr;
+		size_t len = 0;
+		size_t cap = 0;
+		void* vptr = nullptr;		// 已注册回收器时 存 T 的虚表指针
+
+		static bool Recycle(void* const& pool, Object* const& o) noexcept;
+
+	public:
+		ObjectPool(MemPool* const& mempool, size_t const& limit = 1024) noexcept;
+		~ObjectPool() noexcept;
+		ObjectPool(ObjectPool const&) = delete;
+		ObjectPool& operator=(ObjectPool const&) = delete;
+
+		// 优先复用缓存的对象, 没有就 Create( 如果 T 的构造函数首参可为 MemPool*, 将自动传入 ). 失败返回空
+		template<typename...Args>
+		T* Take(Args&&...args) noexcept;
+
+		template<typename...Args>
+		Ptr<T> TakePtr(Args&&...args) noexcept;
+
+		// 析构所有缓存的对象
+		void Clear() noexcept;
+
+		// 返回缓存的对象个数
+		size_t Count() const noexcept;
+	};
+
+
 	/***********************************************************************************/
 	// 所有非 MemPool 类的基类
 	/***********************************************************************************/
@@ -224,6 +705,20 @@ namespace xx
 
 		virtual void ToBBuffer(BBuffer& bb) const noexcept;
 		virtual int FromBBuffer(BBuffer& bb) noexcept;
+
+		// 累加 ToBBuffer 将写入的字节数( 供 BBuffer::CalcRootLen 一次性 Reserve ). 未覆盖的派生类 只是 Reserve 不足, 写入时仍会扩容
+		virtual void CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept;
+
+		// 开启 MemPool::deferRelease 时 Release 能否推迟析构. 析构时要关闭 uv 句柄 或 改动父对象的类( 例如 UvTcpPeer 从 listener.peers 移除自己 )
+		// 需覆盖并返回 false: 推迟期间句柄回调仍会触发, 父对象也可能已先行析构
+		virtual bool Deferrable() const noexcept;
+
+		// 跳过 FromBBuffer 将读的数据, 不创建对象. 派生类需各自提供( 同名静态函数 ). 未提供时继承到这里 返回 -1( 不知道数据长度, 无法跳过 )
+		static int SkipBBuffer(BBuffer& bb) noexcept;
+
+		// 读出 FromBBuffer 将读的数据 直接以 json 追加到 s, 不创建对象. 派生类需各自提供( 同名静态函数. Core 只写成员部分 ). 未提供时 WriteJson 返回 -1, Core 写 Object 的成员( 无 ) 返回 0
+		static int WriteJson(BBuffer& bb, String& s) noexcept;
+		static int WriteJsonCore(BBuffer& bb, String& s) noexcept;
 	};
 
 
@@ -15,45 +15,192 @@ namespace xx
 	};
 
 
+	inline MemArena::~MemArena() noexcept
+	{
+		while (head)
+		{
+			auto next = head->next;
+			free(head);
+			head = next;
+		}
+	}
+
+	inline void* MemArena::Alloc(size_t const& siz, size_t const& headerSiz) noexcept
+	{
+		// 长度前缀紧贴内存头之前, 并令数据区 16 字节对齐
+		auto headerOffset = ((sizeof(size_t) + headerSiz + 15) & ~size_t(15)) - headerSiz;
+		auto len = headerOffset + headerSiz + ((siz + 15) & ~size_t(15));
+
+		// 当前段不够用就换下一段. 下一段不存在或是太小, 就新建一段插入
+		if (cursor + len > end)
+		{
+			auto next = cur ? cur->next : head;
+			if (!next || next->len < len)
+			{
+				auto chunkLen = len > chunkSize ? len : chunkSize;
+				auto c = (Chunk*)malloc(sizeof(Chunk) + chunkLen);
+				if (!c) return nullptr;
+				c->len = chunkLen;
+				c->next = next;
+				if (cur) cur->next = c;
+				else head = c;
+				next = c;
+			}
+			cur = next;
+			cursor = (char*)(cur + 1);
+			end = cursor + cur->len;
+		}
+
+		auto h = cursor + headerOffset;
+		*((size_t*)h - 1) = siz;
+		cursor += len;
+		return h;
+	}
+
+	inline MemArena::Mark MemArena::GetMark() const noexcept
+	{
+		return { cur, cursor };
+	}
+
+	inline void MemArena::Rewind(Mark const& m) noexcept
+	{
+		if (m.chunk)
+		{
+			cur = m.chunk;
+			cursor = m.cursor;
+			end = (char*)(cur + 1) + cur->len;
+		}
+		else Reset();
+	}
+
+	inline void MemArena::Reset() noexcept
+	{
+		// 置空当前段, 下次分配时从 head 开始
+		cur = nullptr;
+		cursor = nullptr;
+		end = nullptr;
+	}
+
+
+
+	inline MemArenaScope::MemArenaScope(MemPool& mp, MemArena& arena) noexcept
+		: mp(mp)
+		, arena(arena)
+		, bak(mp.arena)
+		, mark(arena.GetMark())
+	{
+		mp.arena = &arena;
+	}
+
+	inline MemArenaScope::~MemArenaScope() noexcept
+	{
+		mp.arena = bak;
+		arena.Rewind(mark);
+	}
+
+
+
 	inline MemPool::MemPool() noexcept
+		: returns(nullptr)
 	{
 		headers.fill(nullptr);
+		trimmedCounts.fill(0);
+#if XX_MEMPOOL_STATS
+		memset(&stats, 0, sizeof(stats));
+#endif
 		MPCreateTo(ptrStore);
 		MPCreateTo(idxStore);
+		MPCreateTo(strStore);
 		MPCreateTo(strs);
 	}
 
 	inline MemPool::~MemPool() noexcept
 	{
+		deferRelease = false;
+		Flush();
+		if (deferreds)
+		{
+			Free(deferreds);
+		}
+		handlesCount = 0;
+		Release(handleIndexs);
+		if (handleSlots)
+		{
+			Free(handleSlots);
+		}
 		Release(strs);
+		Release(strStore);
 		Release(idxStore);
 		Release(ptrStore);
-		for (auto header : headers)
+		CollectReturns();
+		for (size_t i = 0; i < slabsLen; ++i)
 		{
-			while (header)
-			{
-				auto next = *(void**)header;
-				free(header);
-				header = next;
-			}
+			PageFree(slabs[i].ptr, slabs[i].len);
 		}
+		free(slabs);
 	}
 
 	template<typename MHType>
 	void* MemPool::Alloc(size_t siz) noexcept
 	{
-		// 根据长度(预留 MHType 的空间)拿到链表下标
+		// 转到 arena 分配. 用 mpIndex == 0 来标识
+		if (arena)
+		{
+			auto h = (MHType*)arena->Alloc(siz, sizeof(MHType));
+			if (!h) return nullptr;
+			h->versionNumber = ++versionNumber;
+			h->mpIndex() = 0;
+			return h + 1;
+		}
+
+		// 跨线程模式下只有 owner 线程可分配. 顺便回收别的线程退回的内存块
+		if (crossThread)
+		{
+			assert(std::this_thread::get_id() == ownerThreadId);
+			if (returns.load(std::memory_order_relaxed)) CollectReturns();
+		}
+
+		// 大块内存直接向系统申请( 对象不走这里, 以确保 Weak / Ref 检测版本号时内存总是可读 )
 		assert(siz);
-		siz += sizeof(MHType);
-		auto idx = Calc2n(siz);
-		if (siz > (size_t(1) << idx)) siz = size_t(1) << ++idx;
+		if constexpr (std::is_same_v<MHType, MemHeader>)
+		{
+			if (siz + sizeof(MHType) > largeThreshold) return AllocLarge(siz);
+		}
+
+		// 根据长度(预留 MHType 的空间)拿到链表下标
+		auto idx = CalcIndex(siz + sizeof(MHType));
+		if ((softLimit || hardLimit) && CheckBudget(IndexToSize(idx))) return nullptr;
 
-		// 试从链表拿指针. 拿不到就分配.
+#if XX_MEMPOOL_STATS
+		auto& st = stats.items[idx];
+		++st.allocs;
+#endif
+
+		// 试从链表拿指针. 拿不到就从 slab 切一批.
 		auto p = headers[idx];
-		if (p) headers[idx] = *(void**)p;
-		else p = malloc(siz);
+		if (p)
+		{
+			headers[idx] = *(void**)p;
+#if XX_MEMPOOL_STATS
+			++st.hits;
+			--st.caches;
+#endif
+		}
+		else
+		{
+			p = Refill(idx);
+#if XX_MEMPOOL_STATS
+			++st.misses;
+#endif
+		}
 		if (!p) return nullptr;
 
+		usedBytes += IndexToSize(idx);
+#if XX_MEMPOOL_STATS
+		if (++st.lives > st.peakLives) st.peakLives = st.lives;
+		if (usedBytes > stats.peakBytes) stats.peakBytes = usedBytes;
+#endif
+
 		// 填充版本号以及链表下标
 		auto h = (MHType*)p;
 		h->versionNumber = ++versionNumber;
@@ -66,11 +213,27 @@ namespace xx
 	{
 		if (!p) return;
 		auto h = (MHType*)p - 1;
-		assert(h->mpIndex() > 0 && h->mpIndex() < headers.size());
 		auto idx = h->mpIndex();
+		if (!idx)									// arena 内存块: 只令 Weak / Ref 失效, 靠 Rewind 回收
+		{
+			h->versionNumber = 0;
+			return;
+		}
+		assert(idx < headers.size());
+		if (crossThread && std::this_thread::get_id() != ownerThreadId)
+		{
+			PushReturn(h, idx);
+			return;
+		}
+		if (idx == 1)								// 大块内存: 直接归还系统
+		{
+			FreeLarge(h);
+			return;
+		}
 		if constexpr (sizeof(void*) < 8) h->versionNumber = 0;
 		*(void**)h = headers[idx];
 		headers[idx] = h;
+		StatFree(idx);
 	}
 
 	inline void* MemPool::Realloc(void* const& p, size_t const& newSize, size_t const& dataLen) noexcept
@@ -83,10 +246,27 @@ namespace xx
 		if (!p) return Alloc(newSize);
 
 		auto h = (MemHeader*)p - 1;
-		auto originalSize = (size_t(1) << h->mpIndex()) - sizeof(MemHeader);
+		size_t originalSize;
+		switch (h->mpIndex())
+		{
+		case 0:											// arena: 内存头前方存有数据区长度
+			originalSize = *((size_t*)h - 1);
+			break;
+		case 1:											// 大块内存: 页首存有映射长度
+			originalSize = *((size_t*)h - 1) - 16;
+			break;
+		default:
+			originalSize = IndexToSize(h->mpIndex()) - sizeof(MemHeader);
+		}
 		if (originalSize >= newSize) return p;
 
+#ifdef __linux__
+		// 大块内存扩容: remap( 失败多半是超出内存预算, 不再尝试 Alloc + memcpy )
+		if (h->mpIndex() == 1) return ReallocLarge(h, newSize);
+#endif
+
 		auto np = Alloc(newSize);
+		if (!np) return nullptr;									// 失败时( 超出内存预算 ) p 保持不变
 		memcpy(np, p, std::min(originalSize, dataLen));
 		Free(p);
 		return np;
@@ -202,12 +382,819 @@ namespace xx
 		auto h = (MemHeader_Object*)p - 1;
 		if (!h->versionNumber) return;								// 防 Release 重入
 		assert(!h->refs);											// 防 Ptr<> 方式使用时过早的被 Release
-		assert(h->mpIndex() > 0 && h->mpIndex() < headers.size());	// 防长度部分被破坏
+		assert(h->mpIndex() < headers.size());						// 防长度部分被破坏
 		auto idx = h->mpIndex();
+
+		// 作废指向它的句柄( 句柄表非线程安全. 非 owner 线程释放的 退回后由 owner 在 CollectReturns 中作废 )
+		if ((!crossThread || std::this_thread::get_id() == ownerThreadId) && handlesCount)
+		{
+			ReleaseHandle(p);
+		}
+
+		// 试交给对象池回收. 期间版本号置 0 防重入, 成功后换新版本号令 Weak / Ref 失效
+		// arena 中的对象不回收( 其内存随 Rewind 作废, 进了池子会变成悬空指针 )
+		if (recyclersLen && idx && (!crossThread || std::this_thread::get_id() == ownerThreadId))
+		{
+			auto vptr = *(void**)p;
+			for (size_t i = 0; i < recyclersLen; ++i)
+			{
+				if (recyclers[i].vptr != vptr) continue;
+				h->versionNumber = 0;
+				if (recyclers[i].func(recyclers[i].pool, p))
+				{
+					h->versionNumber = ++versionNumber;
+					h->mpIndex() = idx;
+					return;
+				}
+			}
+		}
+
 		h->versionNumber = 0;
+
+		// 延迟析构: 入队后返回
+		if (deferRelease && idx && (!crossThread || std::this_thread::get_id() == ownerThreadId) && p->Deferrable() && PushDeferred(p, idx)) return;
+
+		Destroy(p, idx);
+	}
+
+	inline void MemPool::Destroy(Object* const& p, size_t const& idx) noexcept
+	{
+		auto h = (MemHeader_Object*)p - 1;
 		p->~Object();
+		if (!idx) return;											// arena 内存块不回收
+		if (crossThread && std::this_thread::get_id() != ownerThreadId)
+		{
+			PushReturn(h, idx | returnObjectFlag);
+			return;
+		}
 		*(void**)h = headers[idx];
 		headers[idx] = h;
+		StatFree(idx);
+	}
+
+	inline bool MemPool::PushDeferred(Object* const& p, size_t const& idx) noexcept
+	{
+		if (deferredsLen == deferredsCap)
+		{
+			// 队列自身的内存不能分配到 arena 中
+			auto bak = arena;
+			arena = nullptr;
+			auto newCap = deferredsCap ? deferredsCap * 2 : 256;
+			auto newBuf = (DeferredRelease*)Alloc(sizeof(DeferredRelease) * newCap);
+			arena = bak;
+			if (!newBuf) return false;
+			if (deferreds)
+			{
+				memcpy(newBuf, deferreds, sizeof(DeferredRelease) * deferredsLen);
+				Free(deferreds);
+			}
+			deferreds = newBuf;
+			deferredsCap = newCap;
+		}
+		deferreds[deferredsLen++] = DeferredRelease{ p, idx };
+		return true;
+	}
+
+	inline size_t MemPool::ReleaseDeferred(uint64_t const& microseconds) noexcept
+	{
+		if (!deferredsLen) return 0;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(microseconds);
+		size_t n = 0;
+		while (deferredsLen)
+		{
+			auto d = deferreds[--deferredsLen];
+			Destroy(d.pointer, d.idx);
+			// 每析构一批看一次时间
+			if (!(++n & 31) && std::chrono::steady_clock::now() >= deadline) break;
+		}
+		return n;
+	}
+
+	inline size_t MemPool::Flush() noexcept
+	{
+		size_t n = 0;
+		while (deferredsLen)
+		{
+			auto d = deferreds[--deferredsLen];
+			Destroy(d.pointer, d.idx);
+			++n;
+		}
+		return n;
+	}
+
+	inline size_t MemPool::GetDeferredCount() const noexcept
+	{
+		return deferredsLen;
+	}
+
+
+
+	inline bool MemPool::AddRecycler(void* const& vptr, void* const& pool, bool(*func)(void* const& pool, Object* const& o) noexcept) noexcept
+	{
+		if (recyclersLen == recyclers.size()) return false;
+		recyclers[recyclersLen++] = { vptr, pool, func };
+		return true;
+	}
+
+	inline void MemPool::RemoveRecycler(void* const& pool) noexcept
+	{
+		for (size_t i = 0; i < recyclersLen; ++i)
+		{
+			if (recyclers[i].pool == pool)
+			{
+				recyclers[i] = recyclers[--recyclersLen];
+				return;
+			}
+		}
+	}
+
+
+
+	inline void MemPool::ReleaseHandle(Object* const& p) noexcept
+	{
+		auto i = handleIndexs->Find((void*)p);
+		if (i == -1) return;
+		auto index = handleIndexs->ValueAt(i);
+		handleIndexs->RemoveAt(i);
+
+		// 换代令旧句柄失效, 槽位压入空闲链表
+		auto& slot = handleSlots[index];
+		slot.pointer = nullptr;
+		++slot.generation;
+		slot.nextFree = handleFreeHead;
+		handleFreeHead = index;
+		--handlesCount;
+	}
+
+	template<typename T>
+	Handle<T> MemPool::MakeHandle(T* const& p) noexcept
+	{
+		static_assert(std::is_base_of_v<Object, T>);
+		if (!p) return Handle<T>();
+
+		// 句柄表自身的内存不能分配到 arena 中
+		auto bak = arena;
+		arena = nullptr;
+		Handle<T> rtv;
+		do
+		{
+			if (!handleIndexs && !MPCreateTo(handleIndexs)) break;
+
+			// 已有句柄
+			auto r = handleIndexs->Add((void*)p, 0);
+			if (!r.success)
+			{
+				auto index = handleIndexs->ValueAt(r.index);
+				rtv = Handle<T>(index, handleSlots[index].generation);
+				break;
+			}
+
+			// 没有空闲槽位就追加. 0 号槽不用
+			uint32_t index = handleFreeHead;
+			if (index)
+			{
+				handleFreeHead = handleSlots[index].nextFree;
+			}
+			else
+			{
+				if (handleSlotsLen == handleSlotsCap)
+				{
+					auto newCap = handleSlotsCap ? handleSlotsCap * 2 : 64;
+					auto newSlots = (HandleSlot*)Alloc(sizeof(HandleSlot) * newCap);
+					if (!newSlots)
+					{
+						handleIndexs->RemoveAt(r.index);
+						break;
+					}
+					if (handleSlots)
+					{
+						memcpy(newSlots, handleSlots, sizeof(HandleSlot) * handleSlotsLen);
+						Free(handleSlots);
+					}
+					else
+					{
+						newSlots[0] = HandleSlot{ nullptr, 0, 0, 0 };
+						handleSlotsLen = 1;
+					}
+					handleSlots = newSlots;
+					handleSlotsCap = newCap;
+				}
+				index = handleSlotsLen++;
+				handleSlots[index].generation = 1;
+			}
+
+			auto& slot = handleSlots[index];
+			slot.pointer = (Object*)p;
+			slot.versionNumber = ((MemHeader_Object*)p - 1)->versionNumber;
+			slot.nextFree = 0;
+			handleIndexs->ValueAt(r.index) = index;
+			++handlesCount;
+			rtv = Handle<T>(index, slot.generation);
+		} while (false);
+		arena = bak;
+		return rtv;
+	}
+
+	template<typename T>
+	Handle<T> MemPool::MakeHandle(Ptr<T> const& p) noexcept
+	{
+		return MakeHandle(p.pointer);
+	}
+
+	template<typename T>
+	T* MemPool::Get(Handle<T> const& h) const noexcept
+	{
+		if (h.index >= handleSlotsLen) return nullptr;
+		auto& slot = handleSlots[h.index];
+		if (slot.generation != h.generation) return nullptr;
+		// 跨线程模式下 对象可能已被别的线程释放而尚未回收. 此时版本号已变( 同 Weak, 内存块回收前 内存总是可读 )
+		if (crossThread && ((MemHeader_Object*)slot.pointer - 1)->versionNumber != slot.versionNumber) return nullptr;
+		return (T*)slot.pointer;
+	}
+
+	template<typename T>
+	Ptr<T> MemPool::GetPtr(Handle<T> const& h) const noexcept
+	{
+		return Ptr<T>(Get(h));
+	}
+
+	inline size_t MemPool::GetHandlesCount() const noexcept
+	{
+		return handlesCount;
+	}
+
+
+
+	template<typename T>
+	Handle<T>::Handle(uint32_t const& index, uint32_t const& generation) noexcept
+		: index(index)
+		, generation(generation)
+	{}
+
+	template<typename T>
+	template<typename O>
+	Handle<T>::Handle(Handle<O> const& o) noexcept
+		: index(o.index)
+		, generation(o.generation)
+	{
+		static_assert(std::is_base_of_v<T, O>);
+	}
+
+	template<typename T>
+	Handle<T>::operator bool() const noexcept
+	{
+		return index != 0;
+	}
+
+	template<typename T>
+	bool Handle<T>::operator==(Handle const& o) const noexcept
+	{
+		return index == o.index && generation == o.generation;
+	}
+
+	template<typename T>
+	bool Handle<T>::operator!=(Handle const& o) const noexcept
+	{
+		return index != o.index || generation != o.generation;
+	}
+
+
+
+	template<typename T>
+	ObjectPool<T>::ObjectPool(MemPool* const& mempool, size_t const& limit) noexcept
+		: mempool(mempool)
+		, limit(limit)
+	{
+		static_assert(std::is_base_of_v<Object, T>);
+	}
+
+	template<typename T>
+	ObjectPool<T>::~ObjectPool() noexcept
+	{
+		Clear();
+		if (vptr) mempool->RemoveRecycler(this);
+		free(objs);
+	}
+
+	template<typename T>
+	bool ObjectPool<T>::Recycle(void* const& pool, Object* const& o) noexcept
+	{
+		auto self = (ObjectPool<T>*)pool;
+		if (self->len >= self->limit) return false;
+		if (self->owns && !self->owns(*self, static_cast<T*>(o))) return false;
+		static_cast<T*>(o)->Reset();
+
+		// Reset 期间可能有别的对象先被回收, 故再判断一次
+		if (self->len >= self->limit) return false;
+		if (self->len == self->cap)
+		{
+			auto newCap = self->cap ? self->cap * 2 : 16;
+			auto newObjs = (T**)realloc(self->objs, newCap * sizeof(T*));
+			if (!newObjs) return false;
+			self->objs = newObjs;
+			self->cap = newCap;
+		}
+		self->objs[self->len++] = static_cast<T*>(o);
+		return true;
+	}
+
+	template<typename T>
+	template<typename...Args>
+	T* ObjectPool<T>::Take(Args&&...args) noexcept
+	{
+		if (len)
+		{
+			auto o = objs[--len];
+			if constexpr (sizeof...(Args) > 0)
+			{
+				if (o->Init(std::forward<Args>(args)...))
+				{
+					// 初始化失败: 不再回收, 直接析构
+					auto bak = limit;
+					limit = 0;
+					mempool->Release(o);
+					limit = bak;
+					return nullptr;
+				}
+			}
+			return o;
+		}
+
+		T* o;
+		if constexpr (std::is_constructible_v<T, MemPool*, Args&&...>)
+		{
+			o = mempool->Create<T>(mempool, std::forward<Args>(args)...);
+		}
+		else
+		{
+			o = mempool->Create<T>(std::forward<Args>(args)...);
+		}
+
+		// 首次创建时拿到虚表指针 注册回收器
+		if (o && limit && !vptr)
+		{
+			vptr = *(void**)o;
+			if (!mempool->AddRecycler(vptr, this, &Recycle)) vptr = nullptr;
+		}
+		return o;
+	}
+
+	template<typename T>
+	template<typename...Args>
+	Ptr<T> ObjectPool<T>::TakePtr(Args&&...args) noexcept
+	{
+		return Ptr<T>(Take(std::forward<Args>(args)...));
+	}
+
+	template<typename T>
+	void ObjectPool<T>::Clear() noexcept
+	{
+		auto bak = limit;
+		limit = 0;
+		while (len)
+		{
+			mempool->Release(objs[--len]);
+		}
+		limit = bak;
+	}
+
+	template<typename T>
+	size_t ObjectPool<T>::Count() const noexcept
+	{
+		return len;
+	}
+
+
+
+	inline bool MemPool::IsArenaMemory(void* const& p) noexcept
+	{
+		return !((MemHeader*)p - 1)->mpIndex();
+	}
+
+	inline bool MemPool::IsArenaMemory(Object* const& p) noexcept
+	{
+		return !((MemHeader_Object*)p - 1)->mpIndex();
+	}
+
+	template<typename T>
+	int MemPool::Promote(Ptr<T>& o) noexcept
+	{
+		if (!o || !IsArenaMemory(o.pointer)) return 0;
+
+		// 关掉 arena 后 序列化 再 反序列化 一次
+		auto bak = arena;
+		arena = nullptr;
+		BBuffer bb(this);
+		bb.WriteRoot(o);
+		Ptr<T> n;
+		auto r = bb.ReadRoot(n);
+		arena = bak;
+		if (r) return r;
+		o = std::move(n);
+		return 0;
+	}
+
+
+
+	inline void MemPool::InitCrossThreadFree() noexcept
+	{
+		ownerThreadId = std::this_thread::get_id();
+		crossThread = true;
+	}
+
+	inline void MemPool::PushReturn(void* const& h, size_t const& idx) noexcept
+	{
+		// 先令 Weak / Ref 失效, 再借用块内空间存 next 和 下标( 块长至少 16 字节 )
+		((MemHeader*)h)->versionNumber = 0;
+		*(size_t*)((char*)h + 8) = idx;
+		auto head = returns.load(std::memory_order_relaxed);
+		do
+		{
+			*(void**)h = head;
+		} while (!returns.compare_exchange_weak(head, h, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	inline void MemPool::CollectReturns() noexcept
+	{
+		auto p = returns.exchange(nullptr, std::memory_order_acquire);
+		while (p)
+		{
+			auto next = *(void**)p;
+			auto idx = *(size_t*)((char*)p + 8);
+			if (idx & returnObjectFlag)
+			{
+				idx &= ~returnObjectFlag;
+				if (handlesCount)
+				{
+					ReleaseHandle((Object*)((MemHeader_Object*)p + 1));
+				}
+			}
+			assert(idx > 0 && idx < headers.size());
+			if (idx == 1)
+			{
+				FreeLarge(p);
+				p = next;
+				continue;
+			}
+			*(void**)p = headers[idx];
+			headers[idx] = p;
+			StatFree(idx);
+			p = next;
+		}
+	}
+
+	inline void MemPool::StatFree(size_t const& idx) noexcept
+	{
+		usedBytes -= IndexToSize(idx);
+#if XX_MEMPOOL_STATS
+		auto& st = stats.items[idx];
+		--st.lives;
+		++st.caches;
+#endif
+	}
+
+	inline int MemPool::CheckBudget(size_t const& siz) noexcept
+	{
+		auto n = usedBytes + siz;
+		if (hardLimit && n > hardLimit)
+		{
+			if (OnHardLimit)
+			{
+				OnHardLimit(siz);
+			}
+			return -1;
+		}
+		if (softLimit)
+		{
+			if (n <= softLimit)
+			{
+				softLimitReached = false;
+			}
+			else if (!softLimitReached)
+			{
+				softLimitReached = true;
+				if (OnSoftLimit)
+				{
+					OnSoftLimit();
+				}
+			}
+		}
+		return 0;
+	}
+
+	inline size_t MemPool::GetUsedBytes() const noexcept
+	{
+		return usedBytes;
+	}
+
+
+
+	inline void* MemPool::AllocLarge(size_t const& siz) noexcept
+	{
+		auto len = (siz + 16 + pageSize - 1) & ~(pageSize - 1);
+		if ((softLimit || hardLimit) && CheckBudget(len)) return nullptr;
+		auto base = (char*)PageAlloc(len);
+		if (!base) return nullptr;
+		*(size_t*)base = len;
+		residentBytes += len;
+		usedBytes += len;
+#if XX_MEMPOOL_STATS
+		++stats.largeAllocs;
+		++stats.largeLives;
+		stats.largeBytes += len;
+		if (usedBytes > stats.peakBytes) stats.peakBytes = usedBytes;
+#endif
+		auto h = (MemHeader*)(base + 8);
+		h->versionNumber = ++versionNumber;
+		h->mpIndex() = 1;
+		return h + 1;
+	}
+
+	inline void MemPool::FreeLarge(void* const& h) noexcept
+	{
+		auto base = (char*)h - 8;
+		auto len = *(size_t*)base;
+		residentBytes -= len;
+		usedBytes -= len;
+#if XX_MEMPOOL_STATS
+		--stats.largeLives;
+		stats.largeBytes -= len;
+#endif
+		PageFree(base, len);
+	}
+
+#ifdef __linux__
+	inline void* MemPool::ReallocLarge(void* const& h, size_t const& newSize) noexcept
+	{
+		auto base = (char*)h - 8;
+		auto len = *(size_t*)base;
+		auto newLen = (newSize + 16 + pageSize - 1) & ~(pageSize - 1);
+		if ((softLimit || hardLimit) && CheckBudget(newLen - len)) return nullptr;
+		auto p = mremap(base, len, newLen, MREMAP_MAYMOVE);
+		if (p == MAP_FAILED) return nullptr;
+		base = (char*)p;
+		*(size_t*)base = newLen;
+		residentBytes += newLen - len;
+		usedBytes += newLen - len;
+#if XX_MEMPOOL_STATS
+		stats.largeBytes += newLen - len;
+		if (usedBytes > stats.peakBytes) stats.peakBytes = usedBytes;
+#endif
+		return base + 16;
+	}
+#endif
+
+
+
+	inline void* MemPool::Refill(size_t const& idx) noexcept
+	{
+		auto blockSiz = IndexToSize(idx);
+		char* p = nullptr;
+		size_t len = 0;
+
+		// 优先复用同下标已 Trim 的 slab
+		if (trimmedCounts[idx])
+		{
+			for (size_t i = 0; i < slabsLen; ++i)
+			{
+				if (slabs[i].trimmed && slabs[i].idx == idx)
+				{
+					slabs[i].trimmed = false;
+					--trimmedCounts[idx];
+					p = slabs[i].ptr;
+					len = slabs[i].len;
+					break;
+				}
+			}
+			assert(p);
+		}
+		else
+		{
+			len = blockSiz <= slabSize / 4 ? slabSize : ((blockSiz + pageSize - 1) & ~(pageSize - 1));
+			p = AddSlab(idx, len);
+			if (!p) return nullptr;
+		}
+		residentBytes += len;
+
+		// 返回第 0 块, 其余倒序压入链表( 这样分配出去的地址是递增的 )
+		auto n = len / blockSiz;
+		for (auto i = n - 1; i > 0; --i)
+		{
+			auto b = p + i * blockSiz;
+			*(void**)b = headers[idx];
+			headers[idx] = b;
+		}
+#if XX_MEMPOOL_STATS
+		stats.items[idx].caches += n - 1;
+#endif
+		return p;
+	}
+
+	inline char* MemPool::AddSlab(size_t const& idx, size_t const& len) noexcept
+	{
+		if (slabsLen == slabsCap)
+		{
+			auto newCap = slabsCap ? slabsCap * 2 : 64;
+			auto newSlabs = (Slab*)realloc(slabs, newCap * sizeof(Slab));
+			if (!newSlabs) return nullptr;
+			slabs = newSlabs;
+			slabsCap = newCap;
+		}
+		auto p = (char*)PageAlloc(len);
+		if (!p) return nullptr;
+
+		// 按地址顺序插入
+		auto i = FindSlab(p) + 1;
+		memmove(slabs + i + 1, slabs + i, (slabsLen - i) * sizeof(Slab));
+		slabs[i] = { p, len, idx, false };
+		++slabsLen;
+		return p;
+	}
+
+	inline size_t MemPool::PrewarmIndex(size_t const& idx, size_t const& count) noexcept
+	{
+		assert(idx < headers.size());
+		if (crossThread) CollectReturns();
+
+		// 数一下链表中已有的空闲块
+		size_t n = 0;
+		for (auto p = headers[idx]; p && n < count; p = *(void**)p) ++n;
+		if (n >= count) return 0;
+
+		// 缺的部分一次切成一整个 slab
+		auto blockSiz = IndexToSize(idx);
+		auto len = ((count - n) * blockSiz + pageSize - 1) & ~(pageSize - 1);
+		auto p = AddSlab(idx, len);
+		if (!p) return 0;
+		residentBytes += len;
+
+		// 倒序压入链表头部, 这样分配出去的地址是递增的
+		n = len / blockSiz;
+		for (auto i = n; i > 0; --i)
+		{
+			auto b = p + (i - 1) * blockSiz;
+			*(void**)b = headers[idx];
+			headers[idx] = b;
+		}
+#if XX_MEMPOOL_STATS
+		stats.items[idx].caches += n;
+#endif
+		return n;
+	}
+
+	inline size_t MemPool::Prewarm(size_t const& siz, size_t const& count) noexcept
+	{
+		assert(siz);
+		if (siz + sizeof(MemHeader) > largeThreshold) return 0;
+		return PrewarmIndex(CalcIndex(siz + sizeof(MemHeader)), count);
+	}
+
+	template<typename T>
+	size_t MemPool::Prewarm(size_t const& count) noexcept
+	{
+		if constexpr (std::is_base_of_v<Object, T>)
+		{
+			return PrewarmIndex(CalcIndex(sizeof(T) + sizeof(MemHeader_Object)), count);
+		}
+		else
+		{
+			return Prewarm(sizeof(T), count);
+		}
+	}
+
+	inline size_t MemPool::Prewarm(MemPoolStats const& s) noexcept
+	{
+		size_t rtv = 0;
+		for (size_t i = MinIndex(); i < s.items.size() && IndexToSize(i) <= largeThreshold; ++i)
+		{
+			if (s.items[i].peakLives)
+			{
+				rtv += PrewarmIndex(i, (size_t)s.items[i].peakLives);
+			}
+		}
+		return rtv;
+	}
+
+	inline size_t MemPool::FindSlab(void* const& p) const noexcept
+	{
+		// 返回最后一个 ptr <= p 的 slab 的下标. 找不到返回 -1
+		size_t lo = 0, hi = slabsLen;
+		while (lo < hi)
+		{
+			auto mid = (lo + hi) / 2;
+			if (slabs[mid].ptr <= (char*)p) lo = mid + 1;
+			else hi = mid;
+		}
+		return lo - 1;
+	}
+
+	inline size_t MemPool::Trim() noexcept
+	{
+		return ShrinkTo(0);
+	}
+
+	inline size_t MemPool::ShrinkTo(size_t const& bytes) noexcept
+	{
+		if (crossThread) CollectReturns();
+		if (residentBytes <= bytes || !slabsLen) return 0;
+
+		// 统计每个 slab 在链表中的空闲块数
+		auto counts = (size_t*)calloc(slabsLen, sizeof(size_t));
+		if (!counts) return 0;
+		for (auto header : headers)
+		{
+			for (auto p = header; p; p = *(void**)p)
+			{
+				++counts[FindSlab(p)];
+			}
+		}
+
+		// 挑出完全空闲的 slab, 计数改为 -1 做标记
+		size_t rtv = 0;
+		for (size_t i = 0; i < slabsLen && residentBytes - rtv > bytes; ++i)
+		{
+			auto& s = slabs[i];
+			if (s.trimmed || counts[i] != s.len / IndexToSize(s.idx)) continue;
+			counts[i] = (size_t)-1;
+			rtv += s.len;
+		}
+
+		if (rtv)
+		{
+			// 从链表中摘除这些 slab 的内存块( 保持其余块的顺序 )
+			for (auto& header : headers)
+			{
+				auto pp = &header;
+				while (*pp)
+				{
+					if (counts[FindSlab(*pp)] == (size_t)-1) *pp = *(void**)*pp;
+					else pp = (void**)*pp;
+				}
+			}
+
+			// 归还物理内存. 地址保留以确保 Weak / Ref 检测版本号时不会访问到非法地址
+			for (size_t i = 0; i < slabsLen; ++i)
+			{
+				if (counts[i] != (size_t)-1) continue;
+				PageDiscard(slabs[i].ptr, slabs[i].len);
+				slabs[i].trimmed = true;
+				++trimmedCounts[slabs[i].idx];
+#if XX_MEMPOOL_STATS
+				stats.items[slabs[i].idx].caches -= slabs[i].len / IndexToSize(slabs[i].idx);
+#endif
+			}
+			residentBytes -= rtv;
+		}
+		free(counts);
+		return rtv;
+	}
+
+	inline size_t MemPool::GetResidentBytes() const noexcept
+	{
+		return residentBytes;
+	}
+
+	inline MemPoolStats MemPool::Snapshot() const noexcept
+	{
+#if XX_MEMPOOL_STATS
+		auto rtv = stats;
+#else
+		MemPoolStats rtv;
+		memset(&rtv, 0, sizeof(rtv));
+#endif
+		rtv.liveBytes = usedBytes;
+		rtv.residentBytes = residentBytes;
+		return rtv;
+	}
+
+	inline void* MemPool::PageAlloc(size_t const& siz) noexcept
+	{
+#ifdef _WIN32
+		return VirtualAlloc(nullptr, siz, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+		auto p = mmap(nullptr, siz, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		return p == MAP_FAILED ? nullptr : p;
+#endif
+	}
+
+	inline void MemPool::PageFree(void* const& p, size_t const& siz) noexcept
+	{
+#ifdef _WIN32
+		VirtualFree(p, 0, MEM_RELEASE);
+#else
+		munmap(p, siz);
+#endif
+	}
+
+	inline void MemPool::PageDiscard(void* const& p, size_t const& siz) noexcept
+	{
+#ifdef _WIN32
+		// MEM_RESET: 页内容作废, 系统可直接丢弃而不换出. 再对未锁定的页 VirtualUnlock 可令其立即移出工作集( 返回失败是正常的 )
+		VirtualAlloc(p, siz, MEM_RESET, PAGE_READWRITE);
+		VirtualUnlock(p, siz);
+#else
+		madvise(p, siz, MADV_DONTNEED);
+#endif
 	}
 
 
@@ -239,6 +1226,33 @@ namespace xx
 		else return rtv << 1;
 	}
 
+	inline size_t MemPool::CalcIndex(size_t const& n) noexcept
+	{
+		auto k = Calc2n(n);
+
+		// 64 字节以下只按 2^n 分档( 确保内存块长度都是 16 的倍数 )
+		if (k < 6) return ((size_t(1) << k) == n ? k : k + 1) * 4;
+
+		// 将 [2^k, 2^(k+1)) 4 等分, 向上取档. 取到第 4 档即 (k + 1) * 4
+		auto shift = k - 2;
+		return k * 4 + ((n - (size_t(1) << k) + (size_t(1) << shift) - 1) >> shift);
+	}
+
+	inline size_t MemPool::IndexToSize(size_t const& idx) noexcept
+	{
+		return (4 + (idx & 3)) << ((idx >> 2) - 2);
+	}
+
+	inline size_t MemPool::MinIndex() noexcept
+	{
+		return CalcIndex(sizeof(MemHeader));
+	}
+
+	inline size_t MemPool::RoundSize(size_t const& n) noexcept
+	{
+		return IndexToSize(CalcIndex(n));
+	}
+
 
 
 
@@ -264,8 +1278,15 @@ namespace xx
 			// 如果把 TypeId_v<T> 直接放入 std::make_pair, 其值将永远是 0. 故先取出来.
 			auto typeId = TypeId_v<T>;
 
-			// 插入字典占位, 分配到实际指针后替换
-			auto addResult = mp->idxStore->Add(ptrOffset, std::make_pair(nullptr, typeId));
+			// 插入字典占位, 分配到实际指针后替换( 字典自身的内存不能分配到 arena 中 ). 树形类型不会被引用, 不进字典
+			int idx = -1;
+			if constexpr (!IsTree_v<T>)
+			{
+				auto arena = mp->arena;
+				mp->arena = nullptr;
+				idx = mp->idxStore->Add(ptrOffset, std::make_pair(nullptr, typeId)).index;
+				mp->arena = arena;
+			}
 
 			// 拿内存
 			auto p = mp->Alloc<MemHeader_Object>(sizeof(T));
@@ -277,7 +1298,10 @@ namespace xx
 			h->typeId = typeId;
 
 			// 将字典中的 value 替换成真实指针
-			mp->idxStore->ValueAt(addResult.index).first = p;
+			if constexpr (!IsTree_v<T>)
+			{
+				mp->idxStore->ValueAt(idx).first = p;
+			}
 			try
 			{
 				// 调构造函数
@@ -286,15 +1310,82 @@ namespace xx
 			catch (...)
 			{
 				// 从字典移除
-				mp->idxStore->RemoveAt(addResult.index);
+				if constexpr (!IsTree_v<T>)
+				{
+					mp->idxStore->RemoveAt(idx);
+				}
 				mp->template Free<MemHeader_Object>(p);
 				return nullptr;
 			}
 		};
+
+		skippers[TypeId_v<T>] = [](BBuffer& bb) noexcept ->int
+		{
+			return T::SkipBBuffer(bb);
+		};
+
+		jsoners[TypeId_v<T>] = [](BBuffer& bb, String& s) noexcept ->int
+		{
+			return T::WriteJson(bb, s);
+		};
+
+		trees[TypeId_v<T>] = IsTree_v<T>;
+
+		// 生成祖先表. 若本类型是某些已注册类型的缺失父类, 顺便为它们重建
+		if (!BuildAncestry(TypeId_v<T>))
+		{
+			++ancestryPendings;
+		}
+		else if (ancestryPendings)
+		{
+			ancestryPendings = 0;
+			for (size_t i = 1; i < creators.size(); ++i)
+			{
+				if (creators[i] && !typeDepths[i] && !BuildAncestry((uint16_t)i))
+				{
+					++ancestryPendings;
+				}
+			}
+		}
+	}
+
+	inline bool MemPool::BuildAncestry(uint16_t const& typeId) noexcept
+	{
+		// 从自己向上收集到 Object( 0 ) 为止
+		std::array<uint16_t, maxTypeDepth> chain;
+		size_t len = 0;
+		for (auto tid = typeId; tid; tid = pids[tid])
+		{
+			if (!creators[tid]) return false;		// 父类还没注册
+			if (len == chain.size())
+			{
+				typeDepths[typeId] = 0;				// 超深: 不生成, IsBaseOf 回溯
+				return true;
+			}
+			chain[len++] = tid;
+		}
+
+		// 倒序填入: 深度 d 的祖先放在 [d - 1]
+		auto& ancestors = typeAncestors[typeId];
+		for (size_t i = 0; i < len; ++i)
+		{
+			ancestors[i] = chain[len - 1 - i];
+		}
+		typeDepths[typeId] = (uint8_t)len;
+		return true;
 	}
 
 	inline bool MemPool::IsBaseOf(uint32_t const& baseTypeId, uint32_t typeId) noexcept
 	{
+		// Object 是所有类型的基类
+		if (typeId == baseTypeId || !baseTypeId) return true;
+
+		// 双方祖先表都就绪: 看 typeId 在 base 的深度处的祖先是否为 base
+		auto bd = typeDepths[(uint16_t)baseTypeId];
+		auto d = typeDepths[(uint16_t)typeId];
+		if (bd && d) return bd < d && typeAncestors[(uint16_t)typeId][bd - 1] == baseTypeId;
+
+		// 未注册 / 超深: 沿 pids 回溯
 		for (; typeId != baseTypeId; typeId = pids[typeId])
 		{
 			if (!typeId || typeId == pids[typeId]) return false;
@@ -353,6 +1444,11 @@ namespace xx
 	inline void Object::ToStringCore(String& s) const noexcept {}
 	inline void Object::ToBBuffer(BBuffer& bb) const noexcept {}
 	inline int Object::FromBBuffer(BBuffer& bb) noexcept { return 0; }
+	inline void Object::CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept {}
+	inline bool Object::Deferrable() const noexcept { return true; }
+	inline int Object::SkipBBuffer(BBuffer& bb) noexcept { return -1; }
+	inline int Object::WriteJson(BBuffer& bb, String& s) noexcept { return -1; }
+	inline int Object::WriteJsonCore(BBuffer& bb, String& s) noexcept { return 0; }
 
 
 
@@ -103,5 +103,54 @@ namespace xx
 			bb.offset += sizeof(Pos);
 			return 0;
 		}
+		static inline void CalcLen(BBuffer& bb, Pos const &in, size_t& len)
+		{
+			len += sizeof(Pos);
+		}
+		static inline int Skip(BBuffer& bb)
+		{
+			if (bb.offset + sizeof(Pos) > bb.dataLen) return -1;
+			bb.offset += sizeof(Pos);
+			return 0;
+		}
+	};
+
+	// 适配 Pos 之 差量快照( x, y 各按 float 规则, 前面加 1 字节掩码 )
+	template<>
+	struct DeltaFunc<Pos, void>
+	{
+		static inline bool WriteTo(BBuffer& bb, Pos const& base, Pos const& v, double const& q) noexcept
+		{
+			DeltaWriter dw(bb, 2);
+			dw.Write(base.x, v.x, q);
+			dw.Write(base.y, v.y, q);
+			if (dw.count) return true;
+			bb.dataLen = dw.maskOffset;
+			return false;
+		}
+		static inline int ReadFrom(BBuffer& bb, Pos const& base, Pos& out, double const& q) noexcept
+		{
+			DeltaReader dr(bb);
+			if (auto r = dr.Begin(2)) return r;
+			if (auto r = dr.Read(base.x, out.x, q)) return r;
+			return dr.Read(base.y, out.y, q);
+		}
+	};
+
+	// 适配 Pos 之 转 json
+	template<>
+	struct JsonFunc<Pos, void>
+	{
+		static inline int WriteTo(BBuffer& bb, String& s) noexcept
+		{
+			Pos v;
+			if (auto r = bb.Read(v)) return r;
+			s.Append("{\"x\":");
+			JsonAppendNumber(s, v.x);
+			s.Append(",\"y\":");
+			JsonAppendNumber(s, v.y);
+			s.Append('}');
+			return 0;
+		}
 	};
 }
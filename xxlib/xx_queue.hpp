@@ -10,7 +10,7 @@ namespace xx
 		{
 			capacity = 8;
 		}
-		auto bufByteLen = MemPool::Round2n(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
+		auto bufByteLen = MemPool::RoundSize(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
 		buf = (T*)mempool->Alloc((size_t)bufByteLen);
 		assert(buf);
 		bufLen = size_t(bufByteLen / sizeof(T));
@@ -176,9 +176,9 @@ namespace xx
 		assert(capacity > 0);
 		if (capacity <= bufLen) return;
 
-		auto newBufByteLen = MemPool::Round2n(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
+		auto newBufByteLen = MemPool::RoundSize(capacity * sizeof(T) + sizeof(MemHeader)) - sizeof(MemHeader);
 		auto newBuf = (T*)mempool->Alloc((size_t)newBufByteLen);
-		assert(newBuf);
+		if (!newBuf) abort();										// 超出内存预算. 调用方不检查, 与其越界写 不如就地终止
 		auto newBufLen = size_t(newBufByteLen / sizeof(T));
 
 		// afterPush: ++++++++++++++TH++++++++++++++++
@@ -79,6 +79,9 @@ namespace xx
 		Random(BBuffer* const& bb);
 		void ToBBuffer(BBuffer& bb) const noexcept override;
 		int FromBBuffer(BBuffer& bb) noexcept override;
+		void CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept override;
+		static int SkipBBuffer(BBuffer& bb) noexcept;
+		static int WriteJson(BBuffer& bb, String& s) noexcept;
 
 		void ToString(String& s) const noexcept override;
 	};
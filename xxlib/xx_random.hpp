@@ -171,7 +171,26 @@ namespace xx
 		return 0;
 	}
 
+	inline void Random::CalcBBufferLen(BBuffer& bb, size_t& len) const noexcept
+	{
+		len += 232;
+	}
 
+	inline int Random::SkipBBuffer(BBuffer& bb) noexcept
+	{
+		if (bb.offset + 232 > bb.dataLen) return -1;
+		bb.offset += 232;
+		return 0;
+	}
+
+
+
+	inline int Random::WriteJson(BBuffer& bb, String& s) noexcept
+	{
+		if (int r = SkipBBuffer(bb)) return r;
+		s.Append("{\"type\":\"Random\"}");
+		return 0;
+	}
 
 	inline void Random::ToString(String& s) const noexcept
 	{
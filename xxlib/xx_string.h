@@ -101,6 +101,9 @@ namespace xx
 		String(BBuffer* const& bb);
 		// WriteTo, ReadFrom 直接使用基类的
 
+		// 读出内容 以 json 字串追加到 s
+		static int WriteJson(BBuffer& bb, String& s) noexcept;
+
 		void ToString(String& s) const noexcept override;
 	};
 
@@ -258,6 +258,17 @@ namespace xx
 		: BaseType(bb)
 	{}
 
+	inline int String::WriteJson(BBuffer& bb, String& s) noexcept
+	{
+		size_t len = 0;
+		if (auto rtv = bb.Read(len)) return rtv;
+		if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) return -1;
+		if (bb.offset + len > bb.dataLen) return -2;
+		JsonAppendString(s, bb.buf + bb.offset, len);
+		bb.offset += len;
+		return 0;
+	}
+
 	inline void String::ToString(String& s) const noexcept
 	{
 		s.Reserve(s.dataLen + dataLen);
@@ -275,7 +286,7 @@ namespace xx
 	{
 		static uint32_t GetHashCode(String const& in) noexcept
 		{
-			return in.dataLen == 0 ? 0 : HashFunc<std::pair<char*, size_t>>::GetHashCode(std::make_pair(in.buf, in.dataLen));
+			return (uint32_t)HashBytes(in.buf, in.dataLen);
 		}
 	};
 
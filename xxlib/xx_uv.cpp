@@ -40,7 +40,7 @@ static void CloseAndFree(uv_handle_t* const& p) noexcept
 static void AllocCB(uv_handle_t* h, size_t suggested_size, uv_buf_t* buf) noexcept
 {
 	buf->base = (char*)((xx::MemPool*)h->loop->data)->Alloc(suggested_size);
-	buf->len = decltype(buf->len)(suggested_size);
+	buf->len = buf->base ? decltype(buf->len)(suggested_size) : 0;	// 分配失败( 超出内存预算 ) 时 uv 将以 UV_ENOBUFS 回调, 进而断开
 }
 
 // 地址转为 IP
@@ -87,6 +87,7 @@ xx::UvLoop::UvLoop(MemPool* const& mp)
 	, timers(mp)
 	, asyncs(mp)
 	, dnsVisitors(mp)
+	, zipBuf(mp)
 {
 	ptr = Alloc(sizeof(uv_loop_t), this);
 	if (!ptr) throw - 1;
@@ -99,14 +100,36 @@ xx::UvLoop::UvLoop(MemPool* const& mp)
 	sg_ptr.Cancel();
 }
 
+bool xx::UvLoop::Deferrable() const noexcept
+{
+	return false;
+}
+
 xx::UvLoop::~UvLoop() noexcept
 {
 	assert(ptr);
+	// 先析构掉队列中的对象( 它们可能还引用着 uv 句柄 ), 之后的 Release 立即执行
+	if (releaseCheck)
+	{
+		mempool->deferRelease = false;
+		mempool->Flush();
+		CloseAndFree((uv_handle_t*)releaseCheck);
+		CloseAndFree((uv_handle_t*)releaseIdle);
+		releaseCheck = nullptr;
+		releaseIdle = nullptr;
+	}
 	udpListeners.ForEachRevert([mp = this->mempool](auto& o) noexcept { mp->Release(o); });
 	udpClients.ForEachRevert([&mp = this->mempool](auto& o) noexcept { mp->Release(o); });
 	tcpListeners.ForEachRevert([&mp = this->mempool](auto& o) noexcept { mp->Release(o); });
 	tcpClients.ForEachRevert([&mp = this->mempool](auto& o) noexcept { mp->Release(o); });
 	mempool->Release(udpTimer); udpTimer = nullptr;
+	mempool->Release(budgetTimer); budgetTimer = nullptr;
+	if (budgetPauseCount) mempool->OnSoftLimit = nullptr;
+	if (budgetCheck)
+	{
+		CloseAndFree((uv_handle_t*)budgetCheck);
+		budgetCheck = nullptr;
+	}
 	mempool->Release(timeoutManager); timeoutManager = nullptr;
 	mempool->Release(rpcMgr);  rpcMgr = nullptr;
 	timers.ForEachRevert([&mp = this->mempool](auto& o) noexcept { mp->Release(o); });
@@ -158,6 +181,145 @@ int xx::UvLoop::InitKcpFlushInterval(uint32_t const& interval) noexcept
 	}) ? 0 : -1;
 }
 
+int xx::UvLoop::InitMemoryBudget(size_t const& softLimit, size_t const& hardLimit, size_t const& pauseCount, uint64_t const& checkIntervalMS) noexcept
+{
+	assert(!budgetTimer && pauseCount);
+	mempool->softLimit = softLimit;
+	mempool->hardLimit = hardLimit;
+	budgetPauseCount = pauseCount;
+
+	// 刚超过时 在本轮循环末尾暂停一批. OnSoftLimit 在 Alloc 中被调用( 可能正处于 uv 的 alloc_cb ), 此时不能调 uv 函数, 只做标记
+	budgetCheck = Alloc(sizeof(uv_check_t), this);
+	if (!budgetCheck) return -1;
+	xx::ScopeGuard sg_check([&]() noexcept { Free(budgetCheck); budgetCheck = nullptr; });
+	if (int r = uv_check_init((uv_loop_t*)ptr, (uv_check_t*)budgetCheck)) return r;
+	sg_check.Set([&]() noexcept { CloseAndFree((uv_handle_t*)budgetCheck); budgetCheck = nullptr; });
+	if (int r = uv_check_start((uv_check_t*)budgetCheck, [](uv_check_t* h) noexcept
+	{
+		auto loop = GetSelf<UvLoop>(h);
+		if (!loop || !loop->budgetPausePending) return;
+		loop->budgetPausePending = false;
+		loop->PauseHeaviestReads(loop->budgetPauseCount);
+	})) return r;
+	uv_unref((uv_handle_t*)budgetCheck);
+
+	if (!mempool->CreateTo(budgetTimer, *this, checkIntervalMS, checkIntervalMS, [this]() noexcept
+	{
+		if (mempool->softLimit && mempool->GetUsedBytes() > mempool->softLimit)
+		{
+			PauseHeaviestReads(budgetPauseCount);
+		}
+		else if (budgetPausedCount)
+		{
+			ResumePausedReads();
+		}
+	})) return -1;
+
+	mempool->OnSoftLimit = [this]() noexcept
+	{
+		budgetPausePending = true;
+	};
+	sg_check.Cancel();
+	return 0;
+}
+
+int xx::UvLoop::InitDeferredRelease(uint64_t const& sliceUS) noexcept
+{
+	assert(!releaseCheck);
+	releaseSliceUS = sliceUS;
+
+	releaseCheck = Alloc(sizeof(uv_check_t), this);
+	if (!releaseCheck) return -1;
+	xx::ScopeGuard sg_check([&]() noexcept { Free(releaseCheck); releaseCheck = nullptr; });
+	if (int r = uv_check_init((uv_loop_t*)ptr, (uv_check_t*)releaseCheck)) return r;
+	sg_check.Set([&]() noexcept { CloseAndFree((uv_handle_t*)releaseCheck); releaseCheck = nullptr; });
+
+	releaseIdle = Alloc(sizeof(uv_idle_t), this);
+	if (!releaseIdle) return -1;
+	xx::ScopeGuard sg_idle([&]() noexcept { Free(releaseIdle); releaseIdle = nullptr; });
+	if (int r = uv_idle_init((uv_loop_t*)ptr, (uv_idle_t*)releaseIdle)) return r;
+	sg_idle.Set([&]() noexcept { CloseAndFree((uv_handle_t*)releaseIdle); releaseIdle = nullptr; });
+
+	if (int r = uv_check_start((uv_check_t*)releaseCheck, [](uv_check_t* h) noexcept
+	{
+		auto loop = GetSelf<UvLoop>(h);
+		if (!loop) return;
+		loop->mempool->ReleaseDeferred(loop->releaseSliceUS);
+
+		// 还有剩余则令下一轮 poll 不阻塞, 清空后停掉
+		if (loop->mempool->GetDeferredCount())
+		{
+			uv_idle_start((uv_idle_t*)loop->releaseIdle, [](uv_idle_t*) noexcept {});
+		}
+		else
+		{
+			uv_idle_stop((uv_idle_t*)loop->releaseIdle);
+		}
+	})) return r;
+
+	// check 句柄不应令 uv_run 保持运行
+	uv_unref((uv_handle_t*)releaseCheck);
+
+	mempool->deferRelease = true;
+	sg_idle.Cancel();
+	sg_check.Cancel();
+	return 0;
+}
+
+size_t xx::UvLoop::PauseHeaviestReads(size_t const& count) noexcept
+{
+	// 可能是在内存紧张时被调用, 故每轮扫描一次 挑出占用最大的, 不使用临时容器
+	size_t rtv = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		UvTcpBase* heaviest = nullptr;
+		size_t maxBytes = 0;
+		auto check = [&](UvTcpBase* const& o) noexcept
+		{
+			if (!o->ptr || o->readPaused) return;
+			auto n = o->GetBufferedBytes();
+			if (!heaviest || n > maxBytes)
+			{
+				heaviest = o;
+				maxBytes = n;
+			}
+		};
+		for (decltype(auto) L : tcpListeners)
+		{
+			for (decltype(auto) p : L->peers)
+			{
+				check(p);
+			}
+		}
+		for (decltype(auto) c : tcpClients)
+		{
+			if (c->state == UvTcpStates::Connected) check(c);
+		}
+		if (!heaviest || heaviest->PauseRead()) break;
+		++rtv;
+	}
+	budgetPausedCount += rtv;
+	return rtv;
+}
+
+size_t xx::UvLoop::ResumePausedReads() noexcept
+{
+	size_t rtv = 0;
+	for (decltype(auto) L : tcpListeners)
+	{
+		for (decltype(auto) p : L->peers)
+		{
+			if (p->readPaused && !p->ResumeRead()) ++rtv;
+		}
+	}
+	for (decltype(auto) c : tcpClients)
+	{
+		if (c->readPaused && !c->ResumeRead()) ++rtv;
+	}
+	budgetPausedCount = 0;
+	return rtv;
+}
+
 int xx::UvLoop::Run(UvRunMode const& mode) noexcept
 {
 	return uv_run((uv_loop_t*)ptr, (uv_run_mode)mode);
@@ -398,6 +560,11 @@ xx::UvDnsVisitor::UvDnsVisitor(UvLoop* const& loop, String_p& domainName, std::f
 #endif
 }
 
+bool xx::UvDnsVisitor::Deferrable() const noexcept
+{
+	return false;
+}
+
 xx::UvDnsVisitor::~UvDnsVisitor()
 {
 	if (timeouter)
@@ -477,6 +644,11 @@ void xx::UvDnsVisitor::OnResolvedCBImpl(void *resolver, int status, void *res)
 
 
 
+bool xx::UvOnDispose::Deferrable() const noexcept
+{
+	return false;
+}
+
 void xx::UvOnDispose::CallOnDispose() noexcept
 {
 	if (disposed) return;
@@ -504,7 +676,14 @@ xx::UvListenerBase::UvListenerBase(UvLoop& loop)
 xx::UvTcpListener::UvTcpListener(UvLoop& loop)
 	: UvListenerBase(loop)
 	, peers(loop.mempool)
+	, peerPool(loop.mempool, 0)
 {
+	// 各 listener 的 peerPool 共用 UvTcpPeer 的虚表指针, 只收自己 accept 的 peer( 其 Init / Reset 都针对 peer.listener )
+	peerPool.owns = [](ObjectPool<UvTcpPeer> const& pool, UvTcpPeer* const& o) noexcept
+	{
+		return &o->listener.peerPool == &pool;
+	};
+
 	ptr = Alloc(sizeof(uv_tcp_t), this);
 	if (!ptr) throw - 1;
 	xx::ScopeGuard sg_ptr([&]() noexcept { Free(ptr); ptr = nullptr; });
@@ -526,11 +705,16 @@ xx::UvTcpListener::~UvTcpListener() noexcept
 {
 	assert(ptr);
 
+	peerPool.Clear();
+	peerPool.limit = 0;
 	peers.ForEachRevert([mp = mempool](auto& o) noexcept { mp->Release(o); });
 	CloseAndFree((uv_handle_t*)ptr);
 	ptr = nullptr;
 	Free(addrPtr);
 	addrPtr = nullptr;
+	loop.tcpListeners[loop.tcpListeners.dataLen - 1]->index_at_container = index_at_container;
+	loop.tcpListeners.SwapRemoveAt(index_at_container);
+	index_at_container = -1;
 }
 
 void xx::UvTcpListener::OnAcceptCB(void* server, int status) noexcept
@@ -546,7 +730,7 @@ void xx::UvTcpListener::OnAcceptCB(void* server, int status) noexcept
 	}
 	else
 	{
-		listener->loop.mempool->CreateTo(peer, *listener);
+		peer = listener->peerPool.Take(*listener);
 	}
 	if (peer && listener->OnAccept)
 	{
@@ -642,6 +826,7 @@ xx::UvTcpUdpBase::UvTcpUdpBase(UvLoop& loop)
 	, loop(loop)
 	, bbRecv(loop.mempool)
 	, bbSend(loop.mempool)
+	, bbUnzip(loop.mempool)
 {
 }
 
@@ -653,25 +838,65 @@ void xx::UvTcpUdpBase::BindTimeoutManager(UvTimeoutManager* const& t) noexcept
 
 // 包头 = 1字节掩码 + 数据长(2/4字节) + 地址(转发) + 流水号(RPC)
 // 1字节掩码:
-// ......XX :   00: 一般数据包      01: RPC请求包       10: RPC回应包
+// ......XX :   00: 一般数据包      01: RPC请求包       10: RPC回应包       11: 控制包( 不带地址. 数据 1 字节: 1 表示本端可解压 )
 // .....X.. :   0: 2字节数据长       1: 4字节数据长
 // ....X... :   0: 包头中不带地址    1: 带地址(长度由 XXXX.... 部分决定, 值需要+1)
+// ...X.... :   不带地址时 1 表示压缩包: 数据 = 原长( 变长 ) + LZ 压缩后的 流水号 + 数据
 void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) noexcept
 {
 	// 检测用户事件代码执行过后收包行为是否还该继续( 如果只是 client disconnect 则用 bbRecv.dataLen == 0 来检测 )
 	auto vn = memHeader().versionNumber;
 
-	bbRecv.WriteBuf(bufPtr, len);					// 追加收到的数据到接收缓冲区
+	// 如果设置了 bbRecv.arena, 每个包的事件函数执行过后 arena 都将回卷到这里
+	auto arena = bbRecv.arena;
+	auto mark = arena ? arena->GetMark() : MemArena::Mark();
+
+	auto inBuf = bufPtr;
+	size_t inLen = len;
+
+	// 流式接收中的大包: 直接从收到的数据回调, 不进 bbRecv
+	if (streamRemain)
+	{
+		auto n = std::min(inLen, streamRemain);
+		streamRemain -= n;
+		auto r = OnReceiveStream ? OnReceiveStream(inBuf, n, streamTotal - streamRemain, streamTotal) : 0;
+		if (arena) arena->Rewind(mark);
+		if (IsReleased(vn)) return;
+		if (r)
+		{
+			DisconnectImpl();
+			return;
+		}
+		if (Disconnected())
+		{
+			bbRecv.Clear();
+			streamRemain = 0;
+			return;
+		}
+		if (n == inLen) return;
+		inBuf += n;
+		inLen -= n;
+	}
+
+	// 追加收到的数据到接收缓冲区. 扩容失败( 超出内存预算 )则断开
+	if (bbRecv.TryReserve(bbRecv.dataLen + inLen))
+	{
+		DisconnectImpl();
+		return;
+	}
+	bbRecv.WriteBuf(inBuf, inLen);
 #ifndef NDEBUG
 	auto maxLen = bbRecv.dataLen;
 #endif
 
 	auto buf = (uint8_t*)bbRecv.buf;				// 方便使用
 	size_t offset = 0;								// 独立于 bbRecv 以避免受到其负面影响
+	size_t needLen = 0;								// 未收完的包的 总长( 含包头 ). 用于一次扩容到位
 	while (offset + 3 <= bbRecv.dataLen)			// 确保 3字节 包头长度
 	{
 		auto typeId = buf[offset];					// 读出头
 		int pkgType = 0;							// 备用
+		auto bb = &bbRecv;							// 收包事件所用的 bb( 压缩包指向 bbUnzip )
 
 		auto dataLen = (size_t)(buf[offset + 1] + (buf[offset + 2] << 8));
 		int headerLen = 3;
@@ -688,7 +913,41 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 			DisconnectImpl();
 			return;
 		}
-		if (offset + headerLen + dataLen > bbRecv.dataLen) break;   // 确保数据长
+
+		// 不带地址 未压缩 的一般大包 流式接收: 回调已收到的部分, 剩下的收到时直接回调
+		if (streamPackageLength && dataLen >= streamPackageLength && (typeId & 0x1B) == 0 && OnReceiveStream)
+		{
+			auto n = std::min(bbRecv.dataLen - offset - headerLen, dataLen);
+			offset += headerLen + n;
+			streamTotal = dataLen;
+			streamRemain = dataLen - n;
+			auto r = OnReceiveStream((char*)buf + offset - n, n, n, dataLen);
+			if (arena) arena->Rewind(mark);
+			if (IsReleased(vn) || !bbRecv.dataLen) return;
+			if (r)
+			{
+				DisconnectImpl();
+				return;
+			}
+			if (Disconnected())
+			{
+				bbRecv.Clear();
+				streamRemain = 0;
+				return;
+			}
+			continue;								// 若未收完 此时 offset 已到数据尾, 循环将退出
+		}
+
+		if (maxPackageLength && dataLen > maxPackageLength)	// 超长
+		{
+			DisconnectImpl();
+			return;
+		}
+		if (offset + headerLen + dataLen > bbRecv.dataLen)	// 确保数据长
+		{
+			needLen = headerLen + dataLen;
+			break;
+		}
 		auto pkgOffset = offset;
 		offset += headerLen;
 
@@ -712,6 +971,7 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 			{
 				OnReceiveRouting(bbRecv, pkgLen, addrOffset, addrLen);	// todo: 部分参数可以省
 			}
+			if (arena) arena->Rewind(mark);
 			if (IsReleased(vn) || !bbRecv.dataLen) return;
 			if (Disconnected())
 			{
@@ -725,6 +985,34 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 		// 非转发包不含返回地址, 清空以便于在事件函数中判断来源( goto LabAfterAddress 的会跳过这步 )
 		senderAddress.Clear();
 
+		if ((typeId & 0x10) > 0)					// 压缩包: 解压到 bbUnzip, 以它抛事件. 本端未声明可解压 则不接受
+		{
+			size_t zOffset = offset;
+			uint32_t rawLen = 0;
+			if (!decompressable
+				|| VarRead7(bbRecv.buf, offset + dataLen, zOffset, rawLen)
+				|| !rawLen
+				|| rawLen > maxUnzipLength
+				|| (maxPackageLength && rawLen > maxPackageLength))
+			{
+				DisconnectImpl();
+				return;
+			}
+			bbUnzip.Clear();
+			if (bbUnzip.TryReserve(rawLen)
+				|| LzDecompress(bbRecv.buf + zOffset, offset + dataLen - zOffset, bbUnzip.buf, rawLen))
+			{
+				DisconnectImpl();
+				return;
+			}
+			bbUnzip.dataLen = rawLen;
+			bbUnzip.offset = 0;
+			bbUnzip.offsetRoot = 0;
+			bbUnzip.readLengthLimit = rawLen;
+			bbUnzip.arena = arena;
+			bb = &bbUnzip;
+		}
+
 
 	LabAfterAddress:
 		bbRecv.offset = offset + addrLen;			// 数据起始位置
@@ -736,8 +1024,9 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 		{
 			if (OnReceivePackage)
 			{
-				OnReceivePackage(bbRecv);
+				OnReceivePackage(*bb);
 			}
+			if (arena) arena->Rewind(mark);
 			if (IsReleased(vn) || !bbRecv.dataLen) return;
 			if (Disconnected())
 			{
@@ -745,10 +1034,22 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 				return;
 			}
 		}
+		else if (pkgType == 3)
+		{
+			if (!addrLen)							// 控制包: 对端声明可解压
+			{
+				if (dataLen != 1)
+				{
+					DisconnectImpl();
+					return;
+				}
+				peerDecompressable = buf[offset] == 1;
+			}
+		}
 		else
 		{
 			uint32_t serial = 0;
-			if (bbRecv.Read(serial))
+			if (bb->Read(serial))
 			{
 				DisconnectImpl();
 				return;
@@ -757,8 +1058,9 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 			{
 				if (OnReceiveRequest)
 				{
-					OnReceiveRequest(serial, bbRecv);
+					OnReceiveRequest(serial, *bb);
 				}
+				if (arena) arena->Rewind(mark);
 				if (IsReleased(vn) || !bbRecv.dataLen) return;
 				if (Disconnected())
 				{
@@ -768,7 +1070,8 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 			}
 			else if (pkgType == 2)
 			{
-				loop.rpcMgr->Callback(serial, &bbRecv);
+				loop.rpcMgr->Callback(serial, bb);
+				if (arena) arena->Rewind(mark);
 				if (IsReleased(vn) || !bbRecv.dataLen) return;
 				if (Disconnected())
 				{
@@ -781,12 +1084,75 @@ void xx::UvTcpUdpBase::ReceiveImpl(char const* const& bufPtr, int const& len) no
 	LabEnd:
 		offset += dataLen;
 	}
-	if (offset < bbRecv.dataLen)
+
+	// 未用掉的数据移到头部( 一个包都没处理完时 不必移动 )
+	if (offset)
 	{
-		memmove(buf, buf + offset, bbRecv.dataLen - offset);
+		if (offset < bbRecv.dataLen)
+		{
+			memmove(buf, buf + offset, bbRecv.dataLen - offset);
+		}
+		bbRecv.dataLen -= offset;
 	}
-	bbRecv.dataLen -= offset;
 	assert((int)bbRecv.dataLen <= maxLen);
+
+	// 已知剩余包的总长( 且受 maxPackageLength 限制 )时, 一次扩容到位, 避免大包接收过程中反复扩容 copy. 失败( 超出内存预算 )则断开
+	if (maxPackageLength && needLen > bbRecv.bufLen)
+	{
+		if (bbRecv.TryReserve(needLen))
+		{
+			DisconnectImpl();
+			return;
+		}
+	}
+}
+
+int xx::UvTcpUdpBase::EnableCompress(size_t const& threshold) noexcept
+{
+	compressThreshold = threshold;
+	decompressable = true;
+	char buf[4] = { 0b00000011, 1, 0, 1 };		// 控制包, 数据长 1, 可解压
+	return SendBytes(buf, 4);
+}
+
+int xx::UvTcpUdpBase::SendPackage(uint8_t const& typeId, char* const& buf, size_t const& dataLen) noexcept
+{
+	if (dataLen <= std::numeric_limits<uint16_t>::max())
+	{
+		auto p = buf + 2;
+		p[0] = typeId;
+		p[1] = (uint8_t)dataLen;
+		p[2] = (uint8_t)(dataLen >> 8);
+		return SendBytes(p, (int)(dataLen + 3));
+	}
+	else
+	{
+		auto p = buf;
+		p[0] = typeId | 0b00000100;
+		p[1] = (uint8_t)dataLen;
+		p[2] = (uint8_t)(dataLen >> 8);
+		p[3] = (uint8_t)(dataLen >> 16);
+		p[4] = (uint8_t)(dataLen >> 24);
+		return SendBytes(p, (int)(dataLen + 5));
+	}
+}
+
+int xx::UvTcpUdpBase::SendCompressed(uint8_t const& pkgType) noexcept
+{
+	auto dataLen = bbSend.dataLen - 5;
+	auto& zb = loop.zipBuf;
+	zb.Clear();
+	if (!zb.TryReserve(5 + 5 + LzBound(dataLen)))
+	{
+		auto zLen = VarWrite7(zb.buf + 5, (uint32_t)dataLen);
+		zLen += LzCompress(bbSend.buf + 5, dataLen, zb.buf + 5 + zLen, loop.zipHashs.data());
+		if (zLen < dataLen)
+		{
+			return SendPackage(pkgType | 0b00010000, zb.buf, zLen);
+		}
+	}
+	// 压不小( 或扩容失败 )就原样发
+	return SendPackage(pkgType, bbSend.buf, dataLen);
 }
 
 int xx::UvTcpUdpBase::SendBytes(BBuffer& bb) noexcept
@@ -798,7 +1164,7 @@ int xx::UvTcpUdpBase::SendRoutingAddress(char const* const& buf, size_t const& l
 {
 	assert(len <= 16);
 	bbSend.Clear();
-	bbSend.Reserve(3 + len);
+	if (bbSend.TryReserve(3 + len)) return -2;						// 超出内存预算
 	bbSend.buf[0] = 0;
 	bbSend.buf[1] = (uint8_t)len;
 	bbSend.buf[2] = (uint8_t)(len >> 8);
@@ -897,6 +1263,7 @@ void xx::UvTcpUdpBase::ClearHandlers() noexcept
 	OnReceivePackage = nullptr;
 	OnReceiveRequest = nullptr;
 	OnReceiveRouting = nullptr;
+	OnReceiveStream = nullptr;
 	OnDispose = nullptr;
 	OnTimeout = nullptr;
 }
@@ -957,6 +1324,7 @@ int xx::UvTcpBase::SendBytes(char const* const& inBuf, int const& len) noexcept
 	};
 	auto mp = (xx::MemPool*)((uv_stream_t*)ptr)->loop->data;
 	auto req = (uv_write_t_ex*)mp->Alloc(sizeof(uv_write_t_ex) + len);
+	if (!req) return -2;											// 超出内存预算
 	req->mp = mp;
 	auto buf = (char*)(req + 1);
 	memcpy(buf, inBuf, len);
@@ -968,6 +1336,26 @@ int xx::UvTcpBase::SendBytes(char const* const& inBuf, int const& len) noexcept
 	});
 }
 
+int xx::UvTcpBase::PauseRead() noexcept
+{
+	if (!ptr || readPaused) return 0;
+	if (int r = uv_read_stop((uv_stream_t*)ptr)) return r;
+	readPaused = true;
+	return 0;
+}
+
+int xx::UvTcpBase::ResumeRead() noexcept
+{
+	if (!ptr || !readPaused) return 0;
+	readPaused = false;
+	return uv_read_start((uv_stream_t*)ptr, AllocCB, (uv_read_cb)OnReadCBImpl);
+}
+
+size_t xx::UvTcpBase::GetBufferedBytes() noexcept
+{
+	return bbRecv.bufLen + bbSend.bufLen + (ptr ? GetSendQueueSize() : 0);
+}
+
 size_t xx::UvTcpBase::GetSendQueueSize() noexcept
 {
 	assert(addrPtr);
@@ -988,37 +1376,81 @@ xx::UvTcpPeer::UvTcpPeer(UvTcpListener & listener)
 {
 	ipBuf.fill(0);
 
+	addrPtr = Alloc(sizeof(sockaddr_in6));
+	if (!addrPtr) throw - 2;
+	xx::ScopeGuard sg_addrPtr([&]() noexcept { Free(addrPtr); addrPtr = nullptr; });
+
+	if (int r = Init(listener)) throw r;
+
+	sg_addrPtr.Cancel();
+}
+
+xx::UvTcpPeer::~UvTcpPeer() noexcept
+{
+	assert(addrPtr);
+	Reset();
+	Free(addrPtr);
+	addrPtr = nullptr;
+}
+
+int xx::UvTcpPeer::Init(UvTcpListener& listener) noexcept
+{
+	assert(&listener == &this->listener && !ptr);
+
 	ptr = Alloc(sizeof(uv_tcp_t), this);
-	if (!ptr) throw - 1;
+	if (!ptr) return -1;
 	xx::ScopeGuard sg_ptr([&]() noexcept { Free(ptr); ptr = nullptr; });
 
-	if (int r = uv_tcp_init((uv_loop_t*)loop.ptr, (uv_tcp_t*)ptr)) throw r;
+	if (int r = uv_tcp_init((uv_loop_t*)loop.ptr, (uv_tcp_t*)ptr)) return r;
 	xx::ScopeGuard sg_ptr_init([&]() noexcept { CloseAndFree((uv_handle_t*)ptr); ptr = nullptr; sg_ptr.Cancel(); });
 
-	if (int r = uv_accept((uv_stream_t*)listener.ptr, (uv_stream_t*)ptr)) throw r;
-	if (int r = uv_read_start((uv_stream_t*)ptr, AllocCB, (uv_read_cb)OnReadCBImpl)) throw r;
-
-	addrPtr = Alloc(sizeof(sockaddr_in6));
-	if (!addrPtr) throw - 2;
+	if (int r = uv_accept((uv_stream_t*)listener.ptr, (uv_stream_t*)ptr)) return r;
+	if (int r = uv_read_start((uv_stream_t*)ptr, AllocCB, (uv_read_cb)OnReadCBImpl)) return r;
 
 	index_at_container = listener.peers.dataLen;
 	listener.peers.Add(this);
+	disposed = false;
 
 	sg_ptr_init.Cancel();
 	sg_ptr.Cancel();
+	return 0;
 }
 
-xx::UvTcpPeer::~UvTcpPeer() noexcept
+void xx::UvTcpPeer::Reset() noexcept
 {
-	assert(addrPtr);
+	if (!ptr) return;
 	CallOnDispose();
 
 	CloseAndFree((uv_handle_t*)ptr);
 	ptr = nullptr;
-	Free(addrPtr);
-	addrPtr = nullptr;
 	listener.peers[listener.peers.dataLen - 1]->index_at_container = index_at_container;
 	listener.peers.SwapRemoveAt(index_at_container);
+	index_at_container = -1;
+
+	// 还原成刚构造时的状态( 容器只清数据不释放内存 )
+	ClearHandlers();
+	UnbindTimeoutManager();
+	userObject.Reset();
+	userData = nullptr;
+	userNumber = 0;
+	routingAddress.Clear();
+	senderAddress.Clear();
+	bbRecv.Clear();
+	bbRecv.arena = nullptr;
+	bbSend.Clear();
+	bbUnzip.Clear();
+	bbUnzip.arena = nullptr;
+	maxPackageLength = 0;
+	streamPackageLength = 0;
+	streamRemain = 0;
+	compressThreshold = 0;
+	peerDecompressable = false;
+	decompressable = false;
+	maxUnzipLength = 1024 * 1024 * 16;
+	if (rpcSerials) rpcSerials->Clear();
+	lastSendData = {};
+	readPaused = false;
+	ipBuf.fill(0);
 }
 
 void xx::UvTcpPeer::DisconnectImpl() noexcept
@@ -1109,6 +1541,7 @@ void xx::UvTcpClient::OnConnectCBImpl(void* req, int status) noexcept
 			client->connTimeouter.Reset();
 		}
 		client->state = UvTcpStates::Connected;
+		client->readPaused = false;
 		uv_read_start((uv_stream_t*)client->ptr, AllocCB, (uv_read_cb)OnReadCBImpl);
 	}
 	if (client->OnConnect)
@@ -1200,6 +1633,8 @@ void xx::UvTcpClient::Disconnect(bool runCallback) noexcept
 
 	bbSend.Clear();
 	bbRecv.Clear();
+	streamRemain = 0;
+	peerDecompressable = false;		// 重连后需对端再次声明
 
 	RpcTraceCallback();					// 有可能再次触发 Disconnect
 	if (runCallback && OnDisconnect)
@@ -1246,6 +1681,11 @@ xx::UvTimer::UvTimer(UvLoop& loop, uint64_t const& timeoutMS, uint64_t const& re
 	sg_ptr.Cancel();
 }
 
+bool xx::UvTimer::Deferrable() const noexcept
+{
+	return false;
+}
+
 xx::UvTimer::~UvTimer() noexcept
 {
 	assert(ptr);
@@ -1299,6 +1739,11 @@ xx::UvTimeoutManager::UvTimeoutManager(UvLoop& loop, uint64_t const& intervalMS,
 	this->defaultInterval = defaultInterval;
 }
 
+bool xx::UvTimeoutManager::Deferrable() const noexcept
+{
+	return false;
+}
+
 xx::UvTimeoutManager::~UvTimeoutManager() noexcept
 {
 	if (timer)
@@ -1475,9 +1920,15 @@ xx::UvRpcManager::UvRpcManager(UvLoop& loop, uint64_t const& intervalMS, int con
 	, ticks(0)
 {
 	if (defaultInterval <= 0) throw - 1;
+	mapping.EnableIncrementalRehash();				// 海量并发请求时, 扩容不卡事件循环
 	timer = loop.CreateTimer(0, intervalMS, [this]() noexcept { Process(); });
 }
 
+bool xx::UvRpcManager::Deferrable() const noexcept
+{
+	return false;
+}
+
 xx::UvRpcManager::~UvRpcManager() noexcept
 {
 	if (timer)
@@ -1547,6 +1998,7 @@ xx::UvUdpListener::UvUdpListener(UvLoop& loop)
 	: UvListenerBase(loop)
 	, peers(loop.mempool)
 {
+	peers.EnableIncrementalRehash();				// 海量连接时, 扩容不卡事件循环
 	ptr = Alloc(sizeof(uv_udp_t), this);
 	if (!ptr) throw - 1;
 	xx::ScopeGuard sg_ptr([&]() noexcept { Free(ptr); ptr = nullptr; });
@@ -1756,6 +2208,7 @@ int xx::UvUdpPeer::OutputImpl(char const* inBuf, int len, void* kcpPtr) noexcept
 	};
 	auto mp = peer->mempool;
 	auto req = (uv_udp_send_t_ex*)mp->Alloc(sizeof(uv_udp_send_t_ex) + len);
+	if (!req) return -2;											// 超出内存预算
 	req->mp = mp;
 	auto buf = (char*)(req + 1);
 	memcpy(buf, inBuf, len);
@@ -1917,8 +2370,14 @@ int xx::UvUdpClient::OutputImpl(char const* inBuf, int len, void* kcpPtr) noexce
 	};
 	auto mp = client->mempool;
 	auto req = (uv_udp_send_t_ex*)mp->Alloc(sizeof(uv_udp_send_t_ex));
+	if (!req) return -2;											// 超出内存预算
 	req->mp = mp;
 	auto buf = (char*)mp->Alloc(len);
+	if (!buf)
+	{
+		mp->Free(req);
+		return -2;
+	}
 	memcpy(buf, inBuf, len);
 	req->buf = uv_buf_init(buf, (uint32_t)len);
 	return uv_udp_send((uv_udp_send_t*)req, (uv_udp_t*)client->ptr, &req->buf, 1, (sockaddr*)client->addrPtr, [](uv_udp_send_t* req, int status) noexcept
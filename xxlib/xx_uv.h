@@ -66,6 +66,19 @@ namespace xx
 	using UvUdpClient_w = Weak<UvUdpClient>;
 
 
+	using UvListenerBase_h = Handle<UvListenerBase>;
+	using UvTcpListener_h = Handle<UvTcpListener>;
+	using UvTcpUdpBase_h = Handle<UvTcpUdpBase>;
+	using UvTcpBase_h = Handle<UvTcpBase>;
+	using UvTcpPeer_h = Handle<UvTcpPeer>;
+	using UvTcpClient_h = Handle<UvTcpClient>;
+	using UvTimer_h = Handle<UvTimer>;
+	using UvUdpListener_h = Handle<UvUdpListener>;
+	using UvUdpBase_h = Handle<UvUdpBase>;
+	using UvUdpPeer_h = Handle<UvUdpPeer>;
+	using UvUdpClient_h = Handle<UvUdpClient>;
+
+
 	enum class UvTcpStates
 	{
 		Disconnected,
@@ -97,6 +110,7 @@ namespace xx
 
 		UvDnsVisitor(UvLoop* const& loop, String_p& domainName, std::function<void(List<String_p>*)>&& cb, int timeoutMS = 0);
 		~UvDnsVisitor();
+		bool Deferrable() const noexcept override;
 	};
 
 
@@ -117,14 +131,41 @@ namespace xx
 		uint32_t udpTicks = 0;
 		std::array<char, 65536> udpRecvBuf;
 		uint32_t kcpInterval = 0;
+		UvTimer* budgetTimer = nullptr;
+		size_t budgetPauseCount = 0;
+		size_t budgetPausedCount = 0;
+		void* budgetCheck = nullptr;
+		bool budgetPausePending = false;
+		void* releaseCheck = nullptr;
+		void* releaseIdle = nullptr;
+		uint64_t releaseSliceUS = 0;
+		BBuffer zipBuf;								// 发包压缩的输出区( 各连接共用 )
+		std::array<uint32_t, 1 << LzHashLog> zipHashs;	// 发包压缩的 hash 表( 各连接共用 )
 
 		explicit UvLoop(MemPool* const& mp);
 		~UvLoop() noexcept;
+		bool Deferrable() const noexcept override;
 
 		int InitPeerTimeoutManager(uint64_t const& intervalMS = 1000, int const& wheelLen = 6, int const& defaultInterval = 5) noexcept;
 		int InitRpcTimeoutManager(uint64_t const& rpcIntervalMS = 1000, int const& rpcDefaultInterval = 5) noexcept;
 		int InitKcpFlushInterval(uint32_t const& interval = 10) noexcept;
 
+		// 设置内存预算( 见 MemPool::softLimit, hardLimit ). 用量超过 softLimit 时 暂停读取缓冲占用最大的 pauseCount 个 tcp 连接,
+		// 之后每隔 checkIntervalMS 检查: 仍超过就继续暂停, 降回以下就全部恢复. 超过 hardLimit 时 收包扩容失败的连接将被断开.
+		// OnSoftLimit 在 Alloc( 可能是 uv 的 alloc_cb )中触发, 故只做标记, 暂停操作推迟到本轮循环末尾( uv check )执行
+		int InitMemoryBudget(size_t const& softLimit, size_t const& hardLimit, size_t const& pauseCount = 8, uint64_t const& checkIntervalMS = 100) noexcept;
+
+		// 暂停读取缓冲占用最大的 count 个 tcp 连接( 已暂停的不算. 逐个扫描挑选, 不分配内存 ). 返回实际暂停的个数
+		size_t PauseHeaviestReads(size_t const& count) noexcept;
+
+		// 恢复读取所有被暂停的 tcp 连接. 返回恢复的个数
+		size_t ResumePausedReads() noexcept;
+
+		// 开启 mempool 的延迟析构( 见 MemPool::deferRelease ). 每轮循环末尾( uv check ) 析构约 sliceUS 微秒,
+		// 队列未清空时用 uv idle 令下一轮不阻塞等待. UvLoop 析构时 将 Flush 剩余对象并关闭延迟析构.
+		// uv 相关类( 持有 uv 句柄 或 反向引用父对象 ) 不入队, Release 时立即析构
+		int InitDeferredRelease(uint64_t const& sliceUS = 1000) noexcept;
+
 		int Run(UvRunMode const& mode = UvRunMode::Default) noexcept;
 		void Stop() noexcept;
 		bool Alive() const noexcept;
@@ -160,6 +201,7 @@ namespace xx
 		std::function<void()> OnDispose;
 		bool disposed = false;
 		virtual void CallOnDispose() noexcept;
+		bool Deferrable() const noexcept override;
 	};
 
 	class UvListenerBase : public UvOnDispose
@@ -181,6 +223,9 @@ namespace xx
 		std::function<void(UvTcpPeer_w)> OnAccept;
 		List<UvTcpPeer*> peers;
 
+		// 设置 peerPool.limit 可开启 UvTcpPeer 复用( 断开的 peer 缓存起来供后续 accept 使用. 不含 OnCreatePeer 创建的 )
+		ObjectPool<UvTcpPeer> peerPool;
+
 		UvTcpListener(UvLoop& loop);
 		~UvTcpListener() noexcept;
 
@@ -246,8 +291,40 @@ namespace xx
 		void* ptr = nullptr;
 		void* addrPtr = nullptr;
 
-		BBuffer bbRecv;
+		BBuffer bbRecv;							// 设置 bbRecv.arena 可令收包事件中 ReadRoot 解出的对象分配于 arena, 事件函数返回后即回卷( 要留下的对象需 Promote )
 		BBuffer bbSend;
+		BBuffer bbUnzip;						// 压缩包解压于此, 收包事件收到的是它而非 bbRecv( arena 同 bbRecv )
+
+
+		// 最大包长( 不含包头 ). 收到超长的包头即断开, 不为其分配内存. 0: 不限
+		size_t maxPackageLength = 0;
+
+		// 大包流式接收: 数据长 >= streamPackageLength 的一般包( 非 RPC, 不带地址, 未压缩 )不攒齐, 每收到一段即回调 OnReceiveStream,
+		// 参数为( 本段数据, 本段长, 已收长( 含本段 ), 数据总长 ). 首段可能为 0 长( 只收到包头 ). 不受 maxPackageLength 限制. 返回非 0 则断开
+		size_t streamPackageLength = 0;
+		std::function<int(char const*, size_t, size_t, size_t)> OnReceiveStream;
+		size_t streamRemain = 0;				// 流式接收中的包 剩余未收长度
+		size_t streamTotal = 0;					// 流式接收中的包 数据总长
+
+		// 压缩: 对端声明可解压后, 数据长 >= compressThreshold 的包( 路由包除外 )压缩发送. 0: 不压缩
+		size_t compressThreshold = 0;
+		bool peerDecompressable = false;
+		bool decompressable = false;			// 本端已调用 EnableCompress. 否则收到压缩包即断开
+
+		// 压缩包解压后长度上限( 另受 maxPackageLength 限制 ). 防止小包声明巨大的解压长度 耗尽内存
+		size_t maxUnzipLength = 1024 * 1024 * 16;
+
+		// Send 时先预算包长一次性 Reserve 再写( 多跑一遍序列化遍历 ). 只在常发大包( 远超 bbSend 现有容量 )的连接上打开
+		bool reserveSend = false;
+
+		// 设置压缩阈值 并发控制包告知对端本端可解压( 对端须为支持压缩的 c++ 版本, 否则不要调用 ). 双方各自调用后 两个方向才都压缩. 未调用的一端收到压缩包即断开
+		int EnableCompress(size_t const& threshold = 256) noexcept;
+
+		// 将 bbSend 中 5 字节之后的数据压缩后发送( 压不小则原样发 ). pkgType: 0 ~ 2
+		int SendCompressed(uint8_t const& pkgType) noexcept;
+
+		// 发送 buf 处预留 5 字节包头 其后 dataLen 字节数据 的包. 按长度填写包头及大包标志
+		int SendPackage(uint8_t const& typeId, char* const& buf, size_t const& dataLen) noexcept;
 
 
 		// 用来放 serial 以便断线时及时发起 Request 超时回调
@@ -336,6 +413,16 @@ namespace xx
 		// 存储最后一次发送的数据的指针及长度( 便于群发 )
 		std::pair<char const*, int> lastSendData;
 
+		// 是否已暂停读取( 内存预算背压 )
+		bool readPaused = false;
+
+		// 暂停 / 恢复 读取. 返回 uv 错误码
+		int PauseRead() noexcept;
+		int ResumeRead() noexcept;
+
+		// 估算占用的内存字节数( 收发缓冲 + 待发队列 )
+		size_t GetBufferedBytes() noexcept;
+
 		size_t GetSendQueueSize() noexcept override;
 		int SendBytes(char const* const& inBuf, int const& len = 0) noexcept override;
 		// todo: SendBytes 支持传入 BBuffer_p 以利于群发, 支持直接拿走 bb 的内存免 copy
@@ -349,6 +436,12 @@ namespace xx
 		UvTcpListener & listener;
 		UvTcpPeer(UvTcpListener& listener);
 		~UvTcpPeer() noexcept;
+
+		// 供 ObjectPool 复用: 断开并清理状态( 保留 bbRecv, bbSend 等容器的内存 )
+		void Reset() noexcept;
+
+		// 供 ObjectPool 复用: 接受新连接. 成功返回 0
+		int Init(UvTcpListener& listener) noexcept;
 		void DisconnectImpl() noexcept override;
 		bool Disconnected() noexcept override;
 		std::array<char, 64> ipBuf;
@@ -391,6 +484,7 @@ namespace xx
 		void* ptr = nullptr;
 		UvTimer(UvLoop& loop, uint64_t const& timeoutMS, uint64_t const& repeatIntervalMS, std::function<void()>&& OnFire = nullptr);
 		~UvTimer() noexcept;
+		bool Deferrable() const noexcept override;
 		static void OnTimerCBImpl(void* handle) noexcept;
 		void SetRepeat(uint64_t const& repeatIntervalMS) noexcept;
 		int Again() noexcept;
@@ -406,6 +500,7 @@ namespace xx
 		int defaultInterval;
 		UvTimeoutManager(UvLoop& loop, uint64_t const& intervalMS, int const& wheelLen, int const& defaultInterval);
 		~UvTimeoutManager() noexcept;
+		bool Deferrable() const noexcept override;
 		void Process() noexcept;
 		void Clear() noexcept;
 		void Add(UvTimeouterBase* const& t, int interval = 0) noexcept;
@@ -441,6 +536,7 @@ namespace xx
 		int ticks = 0;
 		UvRpcManager(UvLoop& loop, uint64_t const& intervalMS, int const& defaultInterval);
 		~UvRpcManager() noexcept;
+		bool Deferrable() const noexcept override;
 		void Process() noexcept;
 		uint32_t Register(std::function<void(uint32_t, BBuffer*)>&& cb, int interval = 0) noexcept;
 		void Unregister(uint32_t const& serial) noexcept;
@@ -11,11 +11,24 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败
+		{
+			bbSend.ReleaseOverBudget();
+			return -1;
+		}
 		auto dataLen = bbSend.dataLen - 5;
+		if (compressThreshold && peerDecompressable && dataLen >= compressThreshold)
+		{
+			return SendCompressed(0b00000000);
+		}
 		if (dataLen <= std::numeric_limits<uint16_t>::max())
 		{
 			auto p = bbSend.buf + 2;
@@ -49,13 +62,27 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败( 同样立即发起超时回调 )
+		{
+			bbSend.ReleaseOverBudget();
+			loop.rpcMgr->Callback(serial, nullptr);
+			return 0;
+		}
 		auto dataLen = bbSend.dataLen - 5;
 		auto r = 0;
-		if (dataLen <= std::numeric_limits<uint16_t>::max())
+		if (compressThreshold && peerDecompressable && dataLen >= compressThreshold)
+		{
+			r = SendCompressed(0b00000001);
+		}
+		else if (dataLen <= std::numeric_limits<uint16_t>::max())
 		{
 			auto p = bbSend.buf + 2;
 			p[0] = 0b00000001;											// 这里标记包头为 Request 类型
@@ -92,11 +119,24 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败
+		{
+			bbSend.ReleaseOverBudget();
+			return -1;
+		}
 		auto dataLen = bbSend.dataLen - 5;
+		if (compressThreshold && peerDecompressable && dataLen >= compressThreshold)
+		{
+			return SendCompressed(0b00000010);
+		}
 		if (dataLen <= std::numeric_limits<uint16_t>::max())
 		{
 			auto p = bbSend.buf + 2;
@@ -129,10 +169,19 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败
+		{
+			bbSend.ReleaseOverBudget();
+			return -1;
+		}
 		auto dataLen = bbSend.dataLen - 5;
 		if (dataLen <= std::numeric_limits<uint16_t>::max())
 		{
@@ -167,10 +216,20 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败( 同样立即发起超时回调 )
+		{
+			bbSend.ReleaseOverBudget();
+			loop.rpcMgr->Callback(serial, nullptr);
+			return 0;
+		}
 		auto dataLen = bbSend.dataLen - 5;
 		auto r = 0;
 		if (dataLen <= std::numeric_limits<uint16_t>::max())
@@ -211,10 +270,19 @@
 		{
 			bbSend.WriteBuf(pkg);
 		}
+		else if (reserveSend)
+		{
+			bbSend.WriteRootReserved(pkg);
+		}
 		else
 		{
 			bbSend.WriteRoot(pkg);
 		}
+		if (bbSend.overBudget)											// 超出内存预算: 丢弃本包 发送失败
+		{
+			bbSend.ReleaseOverBudget();
+			return -1;
+		}
 		auto dataLen = bbSend.dataLen - 5;
 		if (dataLen <= std::numeric_limits<uint16_t>::max())
 		{
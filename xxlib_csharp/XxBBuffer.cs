@@ -15,6 +15,7 @@ namespace xx
         public int dataLenBak;          // 用于 WritePackage 过程中计算包长
         public int offsetRoot;          // offset值写入修正
         public int readLengthLimit;     // 主用于传递给容器类进行长度合法校验
+        public bool packedList;         // 令紧接着读写的 List<数值> 以 长度 + 元素原始小尾字节 的方式打包( 用后自动清除 )
 
         #region write & read funcs
 
@@ -711,7 +712,7 @@ namespace xx
         // 类型编号兼 null 表达, 0 代表 null
         // 如果 offset数据 == bb.offset 则表示当前类为首次序列化, 后面会跟 类数据. 否则就是引用
 
-        // 当 objs / offsets 不为空时, 启用引用读写
+        // 当 objs / offsets 不为空时, 启用引用读写( 树形类型除外, 见 Object.typeIdTrees )
         Dict<object, uint> ptrStore = null;
         Dict<uint, object> idxStore = null;
 
@@ -767,7 +768,7 @@ namespace xx
             {
                 System.Diagnostics.Debug.Assert(v.GetPackageId() != ushort.MaxValue);   // 通常是没有执行 XXXPKG.AllTypes.Register() 所致
                 Write(v.GetPackageId());
-                if (ptrStore != null)
+                if (ptrStore != null && !Object.typeIdTrees[v.GetPackageId()])
                 {
                     var rtv = ptrStore.Add(v, (uint)(dataLen - offsetRoot));        // 试将 v 和 相对offset 放入字典, 得到下标和是否成功
                     Write(ptrStore.ValueAt(rtv.index));                             // 取 offset ( 不管是否成功 )
@@ -790,7 +791,7 @@ namespace xx
             {
                 throw new Exception("Read<T> does not support string type");
             }
-            if (idxStore != null)
+            if (idxStore != null && !Object.typeIdTrees[typeId])
             {
                 uint ptr_offset = 0, bb_offset_bak = (uint)this.offset - (uint)offsetRoot;
                 Read(ref ptr_offset);
@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Collections.Generic;
 using System.Diagnostics;
+using System.Runtime.InteropServices;
 using System.Text;
 
 namespace xx
@@ -402,11 +403,38 @@ namespace xx
 
         public override void ToBBuffer(BBuffer bb)
         {
+            // 打包标记只作用于当前这一个 List
+            var packed = bb.packedList;
+            bb.packedList = false;
+            if (packed && typeof(T).IsPrimitive && typeof(T) != typeof(bool))    // bool 本就是 1 字节
+            {
+                var siz = Marshal.SizeOf(typeof(T));
+                bb.WriteLength(dataLen);
+                if (dataLen == 0) return;
+                bb.Ensure(dataLen * siz);
+                Buffer.BlockCopy(buf, 0, bb.buf, bb.dataLen, dataLen * siz);
+                bb.dataLen += dataLen * siz;
+                return;
+            }
             ListIBBufferImpl<T>.instance.ToBBuffer(bb, this);
         }
 
         public override void FromBBuffer(BBuffer bb)
         {
+            var packed = bb.packedList;
+            bb.packedList = false;
+            if (packed && typeof(T).IsPrimitive && typeof(T) != typeof(bool))
+            {
+                var siz = Marshal.SizeOf(typeof(T));
+                int len = bb.ReadLength();
+                if (bb.readLengthLimit != 0 && len > bb.readLengthLimit) throw new Exception("overflow of limit");
+                if (len > (bb.dataLen - bb.offset) / siz) throw new Exception("overflow of dataLen");
+                Resize(len);
+                if (len == 0) return;
+                Buffer.BlockCopy(bb.buf, bb.offset, buf, 0, len * siz);
+                bb.offset += len * siz;
+                return;
+            }
             ListIBBufferImpl<T>.instance.FromBBuffer(bb, this);
         }
 
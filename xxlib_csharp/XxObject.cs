@@ -61,12 +61,16 @@ namespace xx
         public static TypeIdCreatorFunc[] typeIdCreatorMappings = new TypeIdCreatorFunc[ushort.MaxValue + 1];
         public static Dict<Type, ushort> typeTypeIdMappings = new Dict<Type, ushort>();
 
-        public static void Register<T>(ushort typeId) where T : IObject, new()
+        // 树形类型( 模板中标记了 Tree ) 读写时不经 ptrStore / idxStore, 也不写 offset
+        public static bool[] typeIdTrees = new bool[ushort.MaxValue + 1];
+
+        public static void Register<T>(ushort typeId, bool isTree = false) where T : IObject, new()
         {
             var r = typeTypeIdMappings.Add(typeof(T), typeId);
             System.Diagnostics.Debug.Assert(r.success || typeTypeIdMappings.ValueAt(r.index) == typeId);
             TypeId<T>.value = typeId;
             typeIdCreatorMappings[typeId] = () => { return new T(); };
+            typeIdTrees[typeId] = isTree;
         }
         public static void RegisterInternals()
         {